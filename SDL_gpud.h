@@ -46,6 +46,101 @@ typedef struct
     Uint32 color; /**< Internal */
 } SDL_GPUDVertex;
 
+/**
+ * @brief What happens to primitives recorded past the budget
+ */
+typedef enum
+{
+    SDL_GPUD_OVERFLOW_GROW, /**< Allocates past the budget until the submit */
+    SDL_GPUD_OVERFLOW_DROP_NEWEST, /**< Drops the primitive being recorded */
+    SDL_GPUD_OVERFLOW_DROP_LOWEST_PRIORITY, /**< Drops batches of a lower
+                                             * priority first, then the
+                                             * primitive being recorded */
+} SDL_GPUDOverflow;
+
+/**
+ * @brief Which matrix the primitives are drawn with. Every slot shares the
+ * upload and the render pass of a submit
+ */
+typedef enum
+{
+    SDL_GPUD_SLOT_WORLD, /**< The matrix passed to SDL_SubmitGPUD */
+    SDL_GPUD_SLOT_SCREEN, /**< Pixels of SDL_SetGPUDViewport, origin in the
+                           * top left, drawn last and never depth tested */
+    SDL_GPUD_SLOT_CUSTOM, /**< The matrix of SDL_SetGPUDCustomMatrix */
+} SDL_GPUDSlot;
+
+/**
+ * @brief Where the lines of SDL_DrawGPUDText start relative to the x of the
+ * call, or to the wrap width when one is set
+ */
+typedef enum
+{
+    SDL_GPUD_ALIGN_LEFT, /**< Lines start at x */
+    SDL_GPUD_ALIGN_CENTER, /**< Lines are centered on x */
+    SDL_GPUD_ALIGN_RIGHT, /**< Lines end at x */
+} SDL_GPUDAlign;
+
+/**
+ * @brief Reserves a fixed amount of vertex memory in SDL_InitGPUD that every
+ * submit records into. Memory used by a submit is unavailable until the GPU
+ * has uploaded it, so the budget has to cover the frames in flight. To know
+ * when that is, every submit acquires and submits a command buffer of its own
+ * for the upload ahead of the caller's. With the uploads of three submits
+ * still in flight, SDL_SubmitGPUD blocks until one of them is done. Disables
+ * SDL_SetGPUDFrameCache. Must be called before SDL_InitGPUD
+ * @param size Bytes, zero (the default) for no budget
+ * @param overflow 
+ * @return 
+ */
+bool SDL_SetGPUDBudget(
+    const Uint32 size,
+    const SDL_GPUDOverflow overflow);
+
+/**
+ * @brief Replaces SDL's allocator for every allocation SDL GPUD makes. Must
+ * be called before SDL_InitGPUD and before any replay or ring is opened
+ * @param malloc_func 
+ * @param calloc_func 
+ * @param realloc_func 
+ * @param free_func 
+ * @return 
+ */
+bool SDL_SetGPUDMemoryFunctions(
+    SDL_malloc_func malloc_func,
+    SDL_calloc_func calloc_func,
+    SDL_realloc_func realloc_func,
+    SDL_free_func free_func);
+
+/**
+ * @brief Renders every submit into a target owned by SDL GPUD, a fraction of
+ * the size of SDL_SetGPUDViewport, and blends it over the color texture in
+ * one fullscreen pass at the end of the submit. Primitives are tested
+ * against the farthest depth of every block of the caller's depth texture,
+ * which then needs SDL_GPU_TEXTUREUSAGE_SAMPLER. Must be called before
+ * SDL_InitGPUD
+ * @param scale Divides the viewport, one (the default) to draw straight into
+ * the color texture
+ * @param format SDL_GPU_TEXTUREFORMAT_INVALID for the color format of
+ * SDL_InitGPUD
+ * @return 
+ */
+bool SDL_SetGPUDOverlay(
+    const Uint32 scale,
+    const SDL_GPUTextureFormat format);
+
+/**
+ * @brief Copies every submitted frame into staging memory on a worker thread
+ * while the next frame is recorded. Each submit draws the frame sealed by the
+ * previous submit, so primitives show up one frame late. Cannot be combined
+ * with a budget and skips the frame cache. The memory functions must be
+ * thread safe. Must be called before SDL_InitGPUD
+ * @param enabled 
+ * @return 
+ */
+bool SDL_SetGPUDThreaded(
+    const bool enabled);
+
 /**
  * @brief 
  * @param device 
@@ -79,6 +174,15 @@ void SDL_DrawGPUDPoint(
     const SDL_GPUDVertex* center,
     const float radius);
 
+/**
+ * @brief Draws world points as spheres ray-cast in a fragment shader, 4
+ * vertices each instead of the 36 of a cube, with the depth of the sphere.
+ * Without a shader build for the device, points stay cubes
+ * @param enabled 
+ */
+void SDL_SetGPUDImpostors(
+    const bool enabled);
+
 /**
  * @brief 
  * @param start 
@@ -97,6 +201,15 @@ void SDL_DrawGPUDLine(
     const SDL_GPUDVertex* start,
     const SDL_GPUDVertex* end);
 
+/**
+ * @brief Stores only x and y, for lines that are drawn by SDL_SubmitGPUD2D
+ * @param start 
+ * @param end 
+ */
+void SDL_DrawGPUDLine2D(
+    const SDL_FPoint* start,
+    const SDL_FPoint* end);
+
 /**
  * @brief 
  * @param center
@@ -106,6 +219,93 @@ void SDL_DrawGPUDSphere(
     const SDL_GPUDVertex* center,
     const float radius);
 
+/**
+ * @brief Shapes are recorded as their parameters and expanded into lines on
+ * submit by a compute pass, drawn with one indirect draw per slot after the
+ * other primitives. Threaded submits, captures, streams, budgets and devices
+ * without a shader build expand them on the CPU instead
+ * @param center 
+ * @param normal 
+ * @param radius 
+ */
+void SDL_DrawGPUDCircle(
+    const SDL_GPUDVertex* center,
+    const SDL_GPUDVertex* normal,
+    const float radius);
+
+/**
+ * @brief 
+ * @param center 
+ * @param normal 
+ * @param radius 
+ * @param start Radians
+ * @param end Radians
+ */
+void SDL_DrawGPUDArc(
+    const SDL_GPUDVertex* center,
+    const SDL_GPUDVertex* normal,
+    const float radius,
+    const float start,
+    const float end);
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ * @param radius 
+ */
+void SDL_DrawGPUDCylinder(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end,
+    const float radius);
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ * @param radius 
+ */
+void SDL_DrawGPUDCapsule(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end,
+    const float radius);
+
+/**
+ * @brief 
+ * @param apex 
+ * @param base Center of the base
+ * @param radius 
+ */
+void SDL_DrawGPUDCone(
+    const SDL_GPUDVertex* apex,
+    const SDL_GPUDVertex* base,
+    const float radius);
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ * @param size Length of the head
+ */
+void SDL_DrawGPUDArrow(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end,
+    const float size);
+
+/**
+ * @brief 
+ * @param matrix Inverse of the frustum's view projection matrix
+ */
+void SDL_DrawGPUDFrustum(
+    const void* matrix);
+
+/**
+ * @brief Segments of a full circle for the shapes of the next submit
+ * @param segments Clamped to [4, 128], defaults to 32
+ */
+void SDL_SetGPUDShapeDetail(
+    const int segments);
+
 /**
  * @brief 
  * @param x 
@@ -118,6 +318,113 @@ void SDL_DrawGPUDText(
     const float y,
     const int size);
 
+/**
+ * @brief Counters since SDL_InitGPUD of the cache that keeps the lines of
+ * recently drawn strings and sizes, so repeated text skips the glyph decoder
+ * @param hits 
+ * @param misses 
+ */
+void SDL_GetGPUDTextCache(
+    Uint64* hits,
+    Uint64* misses);
+
+/**
+ * @brief Breaks the lines of SDL_DrawGPUDText at the last space that fits,
+ * or inside words that are wider than the width on their own
+ * @param width In pixels, 0 disables wrapping (default)
+ */
+void SDL_SetGPUDTextWrap(
+    const int width);
+
+/**
+ * @brief 
+ * @param align Defaults to SDL_GPUD_ALIGN_LEFT
+ */
+void SDL_SetGPUDTextAlign(
+    const SDL_GPUDAlign align);
+
+/**
+ * @brief Skips the characters and lines of SDL_DrawGPUDText that are fully
+ * outside the rect before their segments are generated. Labels ignore it
+ * @param rect NULL disables clipping (default)
+ */
+void SDL_SetGPUDTextClip(
+    const SDL_Rect* rect);
+
+/**
+ * @brief Size that SDL_DrawGPUDText covers with the current wrap width.
+ * Characters advance by size + 2 and lines by size + size / 2
+ * @param text 
+ * @param size 
+ * @param width 
+ * @param height 
+ */
+void SDL_MeasureGPUDText(
+    const char* text,
+    const int size,
+    int* width,
+    int* height);
+
+/**
+ * @brief Multiplies the current transform by the matrix and makes the result
+ * current. Primitives are recorded as given and transformed while drawing.
+ * The stack is cleared by every submit
+ * @param matrix 
+ */
+void SDL_PushGPUDTransform(
+    const void* matrix);
+
+/**
+ * @brief 
+ */
+void SDL_PopGPUDTransform();
+
+/**
+ * @brief Replaces the current transform
+ * @param matrix NULL for identity
+ */
+void SDL_SetGPUDTransform(
+    const void* matrix);
+
+/**
+ * @brief Slot of the primitives recorded from now on, kept across submits.
+ * Labels and translucent points are always drawn in the world slot
+ * @param slot 
+ */
+void SDL_SetGPUDSlot(
+    const SDL_GPUDSlot slot);
+
+/**
+ * @brief Matrix of SDL_GPUD_SLOT_CUSTOM, read while drawing
+ * @param matrix NULL for identity
+ */
+void SDL_SetGPUDCustomMatrix(
+    const void* matrix);
+
+/**
+ * @brief Text anchored to a point in the space of the submit's matrix, kept
+ * at a constant size in pixels and centered above the anchor
+ * @param text 
+ * @param anchor 
+ * @param size 
+ * @param occlude Whether the depth texture of the submit hides the label
+ */
+void SDL_DrawGPUDLabel(
+    const char* text,
+    const SDL_GPUDVertex* anchor,
+    const int size,
+    const bool occlude);
+
+/**
+ * @brief Size of the textures passed to SDL_SubmitGPUD, needed for blended
+ * translucency and labels. Set by SDL_SubmitGPUD2D
+ * @param width 
+ * @param height 
+ */
+void SDL_SetGPUDViewport(
+    const Uint32 width,
+    const Uint32 height);
+
 /**
  * @brief 
  * @param command_buffer 
@@ -131,735 +438,7349 @@ void SDL_SubmitGPUD(
     SDL_GPUTexture* depth_texture,
     const void* matrix);
 
-#ifdef __cplusplus
-} /* extern "C" */
-#endif /* ifdef __cplusplus */
-#ifdef __cplusplus
+/**
+ * @brief SDL_SubmitGPUD without a depth texture and with a projection of the
+ * target in pixels, origin in the top left
+ * @param command_buffer 
+ * @param color_texture 
+ * @param width 
+ * @param height 
+ */
+void SDL_SubmitGPUD2D(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture,
+    const Uint32 width,
+    const Uint32 height);
 
 /**
- * @brief 
- * @param color 
+ * @brief Target of SDL_SetGPUDOverlay holding the last submit with
+ * premultiplied alpha, already composited over its color texture
+ * @param width 
+ * @param height 
+ * @return NULL before the first submit or without an overlay
  */
-inline void SDL_SetGPUDColor(
-    const SDL_FColor& color)
-{
-    SDL_SetGPUDColor(&color);
-}
+SDL_GPUTexture* SDL_GetGPUDOverlay(
+    Uint32* width,
+    Uint32* height);
+
+/**
+ * @brief Opaque handle to a memory-mapped capture file
+ */
+typedef struct SDL_GPUDReplay SDL_GPUDReplay;
+
+/**
+ * @brief Appends every subsequent submit to a binary capture file
+ * @param path 
+ * @return 
+ */
+bool SDL_BeginGPUDCapture(
+    const char* path);
 
 /**
  * @brief 
- * @param center 
- * @param radius 
  */
-inline void SDL_DrawGPUDPoint(
-    const SDL_GPUDVertex& center,
-    const float radius)
-{
-    SDL_DrawGPUDPoint(&center, radius);
-}
+void SDL_EndGPUDCapture();
+
+/**
+ * @brief Memory-maps a capture file written by SDL_BeginGPUDCapture
+ * @param path 
+ * @return 
+ */
+SDL_GPUDReplay* SDL_OpenGPUDReplay(
+    const char* path);
 
 /**
  * @brief 
- * @param start 
- * @param end 
+ * @param replay 
  */
-inline void SDL_DrawGPUDBox(
-    const SDL_GPUDVertex& start,
-    const SDL_GPUDVertex& end)
-{
-    SDL_DrawGPUDBox(&start, &end);
-}
+void SDL_CloseGPUDReplay(
+    SDL_GPUDReplay* replay);
 
 /**
  * @brief 
- * @param start 
- * @param end 
+ * @param replay 
+ * @return The number of captured submits
  */
-inline void SDL_DrawGPUDLine(
-    const SDL_GPUDVertex& start,
-    const SDL_GPUDVertex& end)
-{
-    SDL_DrawGPUDLine(&start, &end);
-}
+int SDL_GetGPUDReplayFrames(
+    const SDL_GPUDReplay* replay);
+
+/**
+ * @brief Feeds a captured submit back through SDL_SubmitGPUD
+ * @param replay 
+ * @param frame 
+ * @param command_buffer 
+ * @param color_texture 
+ * @param depth_texture Ignored if the frame was captured without depth
+ * @return false without recording anything if a command of the frame has an
+ * invalid type or size
+ */
+bool SDL_ReplayGPUD(
+    const SDL_GPUDReplay* replay,
+    const int frame,
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture,
+    SDL_GPUTexture* depth_texture);
+
+/**
+ * @brief Sets the destination of SDL_StreamGPUD
+ * @param stream A connected socket or any other SDL_IOStream
+ * @return 
+ */
+bool SDL_BeginGPUDStream(
+    SDL_IOStream* stream);
 
 /**
  * @brief 
- * @param center 
- * @param radius 
  */
-inline void SDL_DrawGPUDSphere(
-    const SDL_GPUDVertex& center,
-    const float radius)
-{
-    SDL_DrawGPUDSphere(&center, radius);
-}
+void SDL_EndGPUDStream();
 
-#endif /* ifdef __cplusplus */
-#endif /* ifndef SDL_GPUD_H */
-#ifdef SDL_GPUD_IMPL
+/**
+ * @brief Streams and discards the recorded primitives instead of rendering
+ * them, delta compressed against the previous call (e.g. for headless servers)
+ * @param matrix 
+ * @param depth Whether the viewer should render with depth
+ */
+void SDL_StreamGPUD(
+    const void* matrix,
+    const bool depth);
 
-#include "SDL_gpud_shaders.h"
+/**
+ * @brief Reads one streamed submit and records its primitives for the next
+ * SDL_SubmitGPUD. The custom matrix and viewport it was streamed with are
+ * used until then and the previous ones are restored after it
+ * @param stream 
+ * @param matrix Receives the 16 floats the submit was streamed with
+ * @param depth Receives whether the submit was streamed with depth
+ * @return false without recording anything if a command of the submit has an
+ * invalid type or size, the encoded words do not cover them exactly or the
+ * submit is a delta against a submit with another number of commands
+ */
+bool SDL_ReceiveGPUDStream(
+    SDL_IOStream* stream,
+    float* matrix,
+    bool* depth);
 
-#define BUFFER_CAPACITY 1024
-#define SPHERE_VERTICES 20
+/**
+ * @brief Opaque handle to a single-producer/single-consumer ring of vertex
+ * batches in shared memory
+ */
+typedef struct SDL_GPUDRing SDL_GPUDRing;
 
-typedef enum
-{
-    COMMAND_TYPE_LINE,
-    COMMAND_TYPE_POLY,
-} CommandType;
+/**
+ * @brief Creates a named shared memory ring, removed again once closed
+ * @param name e.g. "/physics_debug"
+ * @param capacity Bytes, rounded up to a power of two
+ * @return 
+ */
+SDL_GPUDRing* SDL_CreateGPUDRing(
+    const char* name,
+    const Uint32 capacity);
 
-typedef struct Command Command;
-typedef struct Command
-{
-    Command* next;
-    CommandType type;
-    SDL_GPUTransferBuffer* transfer_buffer;
-    SDL_GPUBuffer* buffer;
-    Uint32 size;
-    Uint32 capacity;
-    Uint8* data;
-} Command;
+/**
+ * @brief Opens a ring created by another process
+ * @param name 
+ * @return 
+ */
+SDL_GPUDRing* SDL_OpenGPUDRing(
+    const char* name);
 
-static SDL_GPUDevice* device;
-static SDL_GPUGraphicsPipeline* line_2d_pipeline;
-static SDL_GPUGraphicsPipeline* line_3d_pipeline;
-static SDL_GPUGraphicsPipeline* poly_2d_pipeline;
-static SDL_GPUGraphicsPipeline* poly_3d_pipeline;
-static Uint32 color;
-static Command* head;
-static Command* tail;
+/**
+ * @brief 
+ * @param ring 
+ */
+void SDL_CloseGPUDRing(
+    SDL_GPUDRing* ring);
 
-bool SDL_InitGPUD(
+/**
+ * @brief Producer side, callable without SDL_InitGPUD. Fails if the ring is
+ * full rather than waiting on the consumer
+ * @param ring 
+ * @param primitive_type SDL_GPU_PRIMITIVETYPE_LINELIST or TRIANGLELIST
+ * @param vertices Colors are packed as 0xRRGGBBAA
+ * @param num_vertices A multiple of 2 for lines and 3 for triangles
+ * @return 
+ */
+bool SDL_WriteGPUDRing(
+    SDL_GPUDRing* ring,
+    const SDL_GPUPrimitiveType primitive_type,
+    const SDL_GPUDVertex* vertices,
+    const int num_vertices);
+
+/**
+ * @brief Consumer side, records every batch written so far for the next
+ * SDL_SubmitGPUD. Drops the records from the first one with an invalid type
+ * or size onwards and sets the error
+ * @param ring 
+ */
+void SDL_DrawGPUDRing(
+    SDL_GPUDRing* ring);
+
+/**
+ * @brief Opaque handle to points kept in a GPU buffer across submits
+ */
+typedef struct SDL_GPUDPointCloud SDL_GPUDPointCloud;
+
+/**
+ * @brief Uploads the points once, drawn as quads facing the screen. Fails
+ * when SDL_gpud_shaders.h has no point shader for the device
+ * @param command_buffer Records the upload, outside of any pass
+ * @param points Colors are packed as 0xRRGGBBAA
+ * @param num_points 
+ * @return 
+ */
+SDL_GPUDPointCloud* SDL_CreateGPUDPointCloud(
+    SDL_GPUCommandBuffer* command_buffer,
+    const SDL_GPUDVertex* points,
+    const Uint32 num_points);
+
+/**
+ * @brief Draws points from a buffer of the caller, laid out and packed like
+ * SDL_CreateGPUDPointCloud. The buffer needs
+ * SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ and is never released by SDL GPUD
+ * @param buffer 
+ * @param num_points 
+ * @return 
+ */
+SDL_GPUDPointCloud* SDL_WrapGPUDPointCloud(
+    SDL_GPUBuffer* buffer,
+    const Uint32 num_points);
+
+/**
+ * @brief 
+ * @param cloud 
+ */
+void SDL_DestroyGPUDPointCloud(
+    SDL_GPUDPointCloud* cloud);
+
+/**
+ * @brief Draws every stride-th point with the current transform and slot.
+ * Clouds are neither captured nor streamed, must outlive the submit and need
+ * SDL_SetGPUDViewport
+ * @param cloud 
+ * @param stride One to draw every point
+ * @param size Width of every point in pixels of the viewport
+ */
+void SDL_DrawGPUDPointCloud(
+    SDL_GPUDPointCloud* cloud,
+    const Uint32 stride,
+    const float size);
+
+/**
+ * @brief Opaque handle to the fade and levels of a ground grid
+ */
+typedef struct SDL_GPUDGrid SDL_GPUDGrid;
+
+/**
+ * @brief Grids are the XZ plane evaluated per pixel by a fragment shader,
+ * without an extent. Lines fade out with the distance from the center and
+ * every level is ten times coarser and brighter than the one before. Fails
+ * without a shader build for the device
+ * @param radius Distance from the center at which the lines are gone
+ * @param levels Clamped to [1, 3]
+ * @return 
+ */
+SDL_GPUDGrid* SDL_CreateGPUDGrid(
+    const float radius,
+    const int levels);
+
+/**
+ * @brief 
+ * @param grid 
+ */
+void SDL_DestroyGPUDGrid(
+    SDL_GPUDGrid* grid);
+
+/**
+ * @brief Draws the grid with a single fullscreen draw in the current color,
+ * transform and slot, with the depth of the plane. Grids are neither captured
+ * nor streamed and must outlive the submit
+ * @param grid 
+ * @param center Height of the plane and center of the fade, the lines stay
+ * on multiples of the spacing, so passing the camera does not slide them
+ * @param spacing Between the lines of the finest level
+ */
+void SDL_DrawGPUDGrid(
+    SDL_GPUDGrid* grid,
+    const SDL_GPUDVertex* center,
+    const float spacing);
+
+/**
+ * @brief Opaque handle to the history of a value kept in a GPU ring buffer
+ * across submits
+ */
+typedef struct SDL_GPUDGraph SDL_GPUDGraph;
+
+/**
+ * @brief Creates a graph in the current color. Every submit that draws it
+ * uploads only the samples pushed since the last one. Fails without a graph
+ * shader build
+ * @param capacity Vertices of history, at least 2
+ * @param downsample Samples per vertex pair: one keeps every sample, more
+ * keep the minimum and the maximum of each run of samples in their order
+ * @return 
+ */
+SDL_GPUDGraph* SDL_CreateGPUDGraph(
+    const Uint32 capacity,
+    const Uint32 downsample);
+
+/**
+ * @brief 
+ * @param graph 
+ */
+void SDL_DestroyGPUDGraph(
+    SDL_GPUDGraph* graph);
+
+/**
+ * @brief 
+ * @param graph 
+ * @param value 
+ */
+void SDL_PushGPUDGraph(
+    SDL_GPUDGraph* graph,
+    const float value);
+
+/**
+ * @brief Draws the history as one line strip with the current transform and
+ * slot, oldest on the left. Graphs are neither captured nor streamed and must
+ * outlive the submit
+ * @param graph 
+ * @param rect Filled once the history is full, values grow toward its top as
+ * in the screen slot
+ * @param min Value at the bottom of the rect
+ * @param max Value at the top of the rect
+ */
+void SDL_DrawGPUDGraph(
+    SDL_GPUDGraph* graph,
+    const SDL_FRect* rect,
+    const float min,
+    const float max);
+
+/**
+ * @brief Opaque handle to the recent positions of many entities kept in a GPU
+ * ring buffer across submits
+ */
+typedef struct SDL_GPUDTrails SDL_GPUDTrails;
+
+/**
+ * @brief 
+ * @param num_trails 
+ * @param length Positions kept per trail, at least 2
+ * @return 
+ */
+SDL_GPUDTrails* SDL_CreateGPUDTrails(
+    const Uint32 num_trails,
+    const Uint32 length);
+
+/**
+ * @brief 
+ * @param trails 
+ */
+void SDL_DestroyGPUDTrails(
+    SDL_GPUDTrails* trails);
+
+/**
+ * @brief Appends the newest position of every trail, replacing the oldest
+ * once the history is full. Only the positions pushed since the last submit
+ * that drew the trails are uploaded
+ * @param trails 
+ * @param positions One per trail, colors are packed as 0xRRGGBBAA and their
+ * alpha is ignored
+ */
+void SDL_PushGPUDTrails(
+    SDL_GPUDTrails* trails,
+    const SDL_GPUDVertex* positions);
+
+/**
+ * @brief Draws every trail with the current transform and slot, each segment
+ * faded by its age. Trails are neither captured nor streamed and must outlive
+ * the submit
+ * @param trails 
+ */
+void SDL_DrawGPUDTrails(
+    SDL_GPUDTrails* trails);
+
+/**
+ * @brief Opaque handle to a mesh in buffers of the caller
+ */
+typedef struct SDL_GPUDMesh SDL_GPUDMesh;
+
+/**
+ * @brief Describes a triangle list of the caller to draw as a wireframe
+ * without copying it. Pipelines are created here for every new stride and
+ * offset, at most 16 of them. The buffers are never released by SDL GPUD
+ * @param vertex_buffer Needs SDL_GPU_BUFFERUSAGE_VERTEX
+ * @param stride Bytes between vertices
+ * @param offset Bytes from the start of a vertex to its float3 position
+ * @param index_buffer NULL to draw the vertices in order
+ * @param index_size Ignored without an index buffer
+ * @param num_elements Indices, or vertices without an index buffer
+ * @return NULL if the layout would be the 17th one or its pipelines could not
+ * be created
+ */
+SDL_GPUDMesh* SDL_WrapGPUDMesh(
+    SDL_GPUBuffer* vertex_buffer,
+    const Uint32 stride,
+    const Uint32 offset,
+    SDL_GPUBuffer* index_buffer,
+    const SDL_GPUIndexElementSize index_size,
+    const Uint32 num_elements);
+
+/**
+ * @brief 
+ * @param mesh 
+ */
+void SDL_DestroyGPUDMesh(
+    SDL_GPUDMesh* mesh);
+
+/**
+ * @brief Draws the edges of the mesh in the current color with the current
+ * transform and slot. Meshes are neither captured nor streamed and must
+ * outlive the submit
+ * @param mesh 
+ */
+void SDL_DrawGPUDWireframe(
+    SDL_GPUDMesh* mesh);
+
+/**
+ * @brief Creates a storage buffer in SDL_InitGPUD that compute shaders append
+ * lines into without a readback. Every SDL_SubmitGPUD draws its lines in the
+ * world slot with an indirect draw and then empties it. Must be called before
+ * SDL_InitGPUD
+ * @param num_vertices Zero (the default) for no append buffer
+ * @return 
+ */
+bool SDL_SetGPUDAppendCapacity(
+    const Uint32 num_vertices);
+
+/**
+ * @brief The append buffer holds SDL_GPUDVertex with colors packed as
+ * 0xRRGGBBAA. The first word of the counter is the vertex count of an
+ * SDL_GPUIndirectDrawCommand: a shader reserves two vertices per line with an
+ * atomic add and, if that passed the capacity, takes them back with an
+ * atomic subtract instead of writing. Both are bound as read-write storage
+ * buffers and must be written before SDL_SubmitGPUD
+ * @param counter 
+ * @return NULL without SDL_SetGPUDAppendCapacity
+ */
+SDL_GPUBuffer* SDL_GetGPUDAppendBuffer(
+    SDL_GPUBuffer** counter);
+
+/**
+ * @brief Priority of subsequent primitives under
+ * SDL_GPUD_OVERFLOW_DROP_LOWEST_PRIORITY
+ * @param priority Defaults to zero
+ */
+void SDL_SetGPUDPriority(
+    const int priority);
+
+/**
+ * @brief Counters since SDL_InitGPUD
+ * @param dropped Vertex bytes that were not drawn, including batches whose
+ * GPU buffer could not be created
+ * @param grown Vertex bytes allocated past the budget
+ */
+void SDL_GetGPUDOverflows(
+    Uint64* dropped,
+    Uint64* grown);
+
+/**
+ * @brief Drops primitives identical (type, vertices and color) to one already
+ * recorded since the last submit
+ * @param enabled 
+ */
+void SDL_SetGPUDDeduplicate(
+    const bool enabled);
+
+/**
+ * @brief Counters from the last submit
+ * @param primitives Primitives recorded, including duplicates
+ * @param duplicates Primitives dropped as duplicates
+ * @param bytes Vertex bytes not uploaded
+ */
+void SDL_GetGPUDDuplicates(
+    int* primitives,
+    int* duplicates,
+    Uint32* bytes);
+
+/**
+ * @brief Keeps the GPU buffers of recent submits and reuses them, skipping the
+ * upload, when a submit records exactly the same batches again. Only the GPU
+ * side is saved: a frame is known to be unchanged once it was recorded, so
+ * every primitive is still copied into its batch and hashed as usual. Must be
+ * called before recording
+ * @param enabled 
+ */
+void SDL_SetGPUDFrameCache(
+    const bool enabled);
+
+/**
+ * @brief How points with alpha below one are drawn
+ */
+typedef enum
+{
+    SDL_GPUD_TRANSLUCENCY_NONE, /**< In submission order */
+    SDL_GPUD_TRANSLUCENCY_SORTED, /**< Back to front along the submit's matrix */
+    SDL_GPUD_TRANSLUCENCY_BLENDED, /**< Weighted blended order independent transparency */
+} SDL_GPUDTranslucency;
+
+/**
+ * @brief Sorted and blended translucency defer translucent points to the end
+ * of the submit. Blended translucency needs SDL_SetGPUDViewport with the size
+ * of the submit's textures and sorts instead when SDL_gpud_shaders.h has no
+ * build of its shaders for the device
+ * @param translucency 
+ */
+void SDL_SetGPUDTranslucency(
+    const SDL_GPUDTranslucency translucency);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* ifdef __cplusplus */
+#ifdef __cplusplus
+
+/**
+ * @brief 
+ * @param color 
+ */
+inline void SDL_SetGPUDColor(
+    const SDL_FColor& color)
+{
+    SDL_SetGPUDColor(&color);
+}
+
+/**
+ * @brief 
+ * @param center 
+ * @param radius 
+ */
+inline void SDL_DrawGPUDPoint(
+    const SDL_GPUDVertex& center,
+    const float radius)
+{
+    SDL_DrawGPUDPoint(&center, radius);
+}
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ */
+inline void SDL_DrawGPUDBox(
+    const SDL_GPUDVertex& start,
+    const SDL_GPUDVertex& end)
+{
+    SDL_DrawGPUDBox(&start, &end);
+}
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ */
+inline void SDL_DrawGPUDLine(
+    const SDL_GPUDVertex& start,
+    const SDL_GPUDVertex& end)
+{
+    SDL_DrawGPUDLine(&start, &end);
+}
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ */
+inline void SDL_DrawGPUDLine2D(
+    const SDL_FPoint& start,
+    const SDL_FPoint& end)
+{
+    SDL_DrawGPUDLine2D(&start, &end);
+}
+
+/**
+ * @brief 
+ * @param center 
+ * @param radius 
+ */
+inline void SDL_DrawGPUDSphere(
+    const SDL_GPUDVertex& center,
+    const float radius)
+{
+    SDL_DrawGPUDSphere(&center, radius);
+}
+
+/**
+ * @brief 
+ * @param center 
+ * @param normal 
+ * @param radius 
+ */
+inline void SDL_DrawGPUDCircle(
+    const SDL_GPUDVertex& center,
+    const SDL_GPUDVertex& normal,
+    const float radius)
+{
+    SDL_DrawGPUDCircle(&center, &normal, radius);
+}
+
+/**
+ * @brief 
+ * @param center 
+ * @param normal 
+ * @param radius 
+ * @param start 
+ * @param end 
+ */
+inline void SDL_DrawGPUDArc(
+    const SDL_GPUDVertex& center,
+    const SDL_GPUDVertex& normal,
+    const float radius,
+    const float start,
+    const float end)
+{
+    SDL_DrawGPUDArc(&center, &normal, radius, start, end);
+}
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ * @param radius 
+ */
+inline void SDL_DrawGPUDCylinder(
+    const SDL_GPUDVertex& start,
+    const SDL_GPUDVertex& end,
+    const float radius)
+{
+    SDL_DrawGPUDCylinder(&start, &end, radius);
+}
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ * @param radius 
+ */
+inline void SDL_DrawGPUDCapsule(
+    const SDL_GPUDVertex& start,
+    const SDL_GPUDVertex& end,
+    const float radius)
+{
+    SDL_DrawGPUDCapsule(&start, &end, radius);
+}
+
+/**
+ * @brief 
+ * @param apex 
+ * @param base 
+ * @param radius 
+ */
+inline void SDL_DrawGPUDCone(
+    const SDL_GPUDVertex& apex,
+    const SDL_GPUDVertex& base,
+    const float radius)
+{
+    SDL_DrawGPUDCone(&apex, &base, radius);
+}
+
+/**
+ * @brief 
+ * @param start 
+ * @param end 
+ * @param size 
+ */
+inline void SDL_DrawGPUDArrow(
+    const SDL_GPUDVertex& start,
+    const SDL_GPUDVertex& end,
+    const float size)
+{
+    SDL_DrawGPUDArrow(&start, &end, size);
+}
+
+/**
+ * @brief 
+ * @param text 
+ * @param anchor 
+ * @param size 
+ * @param occlude 
+ */
+inline void SDL_DrawGPUDLabel(
+    const char* text,
+    const SDL_GPUDVertex& anchor,
+    const int size,
+    const bool occlude)
+{
+    SDL_DrawGPUDLabel(text, &anchor, size, occlude);
+}
+
+/**
+ * @brief 
+ * @param grid 
+ * @param center 
+ * @param spacing 
+ */
+inline void SDL_DrawGPUDGrid(
+    SDL_GPUDGrid* grid,
+    const SDL_GPUDVertex& center,
+    const float spacing)
+{
+    SDL_DrawGPUDGrid(grid, &center, spacing);
+}
+
+/**
+ * @brief 
+ * @param graph 
+ * @param rect 
+ * @param min 
+ * @param max 
+ */
+inline void SDL_DrawGPUDGraph(
+    SDL_GPUDGraph* graph,
+    const SDL_FRect& rect,
+    const float min,
+    const float max)
+{
+    SDL_DrawGPUDGraph(graph, &rect, min, max);
+}
+
+/**
+ * @brief 
+ * @param rect 
+ */
+inline void SDL_SetGPUDTextClip(
+    const SDL_Rect& rect)
+{
+    SDL_SetGPUDTextClip(&rect);
+}
+
+#endif /* ifdef __cplusplus */
+#endif /* ifndef SDL_GPUD_H */
+#ifdef SDL_GPUD_IMPL
+
+#include "SDL_gpud_shaders.h"
+
+#if defined(SDL_PLATFORM_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define BUFFER_CAPACITY 1024
+#define ARENA_COMMANDS 64
+#define TRANSFORM_DEPTH 32
+#define SPHERE_VERTICES 20
+#define CAPTURE_MAGIC SDL_FOURCC('G', 'P', 'U', 'D')
+#define CAPTURE_VERSION 2
+#define CAPTURE_FLAG_DEPTH 0x1
+#define CAPTURE_FLAG_KEYFRAME 0x2
+#define CAPTURE_SLOT_SHIFT 16
+#define CAPTURE_TYPE_MASK 0xFFFF
+#define STREAM_MAX_RUN 0xFFFF
+#define CACHED_FRAMES 4
+#define POOL_FENCES 3
+#define TEXT_CACHE_ENTRIES 32
+#define TEXT_CHUNK_LINES 64
+#define GRAPH_MAX_CAPACITY (1 << 20)
+#define TRAIL_MAX_POSITIONS (1 << 24)
+#define WIREFRAME_PIPELINES 16
+#define SORT_RADIX_BITS 11
+#define SORT_RADIX_MASK ((1 << SORT_RADIX_BITS) - 1)
+#define RING_MAGIC SDL_FOURCC('G', 'P', 'U', 'R')
+#define RING_PADDING 0xFFFFFFFF
+#define SHAPE_MIN_DETAIL 4
+#define SHAPE_MAX_DETAIL 128
+#define SHAPE_MAX_VERTICES (SHAPE_MAX_DETAIL * 8 + 8)
+#define SHAPE_MAX_ARCS 12
+
+typedef enum
+{
+    COMMAND_TYPE_LINE,
+    COMMAND_TYPE_POLY,
+    COMMAND_TYPE_TRANSLUCENT,
+    COMMAND_TYPE_OVERLAY,
+    COMMAND_TYPE_LABEL,
+    COMMAND_TYPE_LABEL_OCCLUDED,
+    COMMAND_TYPE_SPHERE,
+    COMMAND_TYPE_GLYPH,
+    COMMAND_TYPE_GLYPH_OCCLUDED,
+} CommandType;
+
+/* Overlay lines leave out z, the pipeline fills it in as zero */
+typedef struct
+{
+    float x;
+    float y;
+    Uint32 color;
+} OverlayVertex;
+
+typedef struct Command Command;
+typedef struct Command
+{
+    Command* next;
+    CommandType type;
+    SDL_GPUTransferBuffer* transfer_buffer;
+    SDL_GPUBuffer* buffer;
+    Uint32 size;
+    Uint32 capacity;
+    Uint8* data;
+    int priority;
+    int transform;
+    SDL_GPUDSlot slot;
+    bool pooled;
+    Uint32 offset; /* Into the pool buffers if pooled */
+} Command;
+
+static SDL_GPUDevice* device;
+static SDL_GPUGraphicsPipeline* line_2d_pipeline;
+static SDL_GPUGraphicsPipeline* line_3d_pipeline;
+static SDL_GPUGraphicsPipeline* poly_2d_pipeline;
+static SDL_GPUGraphicsPipeline* poly_3d_pipeline;
+static SDL_GPUGraphicsPipeline* translucent_2d_pipeline;
+static SDL_GPUGraphicsPipeline* translucent_3d_pipeline;
+static SDL_GPUGraphicsPipeline* resolve_2d_pipeline;
+static SDL_GPUGraphicsPipeline* resolve_3d_pipeline;
+static SDL_GPUGraphicsPipeline* composite_pipeline;
+static SDL_GPUGraphicsPipeline* overlay_depth_pipeline;
+static SDL_GPUGraphicsPipeline* overlay_2d_pipeline;
+static SDL_GPUGraphicsPipeline* overlay_3d_pipeline;
+static SDL_GPUGraphicsPipeline* label_pipeline;
+static SDL_GPUGraphicsPipeline* label_occluded_pipeline;
+static SDL_GPUGraphicsPipeline* glyph_2d_pipeline;
+static SDL_GPUGraphicsPipeline* glyph_pipeline;
+static SDL_GPUGraphicsPipeline* glyph_occluded_pipeline;
+static SDL_GPUGraphicsPipeline* poly_screen_pipeline;
+static SDL_GPUGraphicsPipeline* overlay_screen_pipeline;
+static SDL_GPUGraphicsPipeline* point_2d_pipeline;
+static SDL_GPUGraphicsPipeline* point_3d_pipeline;
+static SDL_GPUGraphicsPipeline* point_screen_pipeline;
+static SDL_GPUGraphicsPipeline* graph_2d_pipeline;
+static SDL_GPUGraphicsPipeline* graph_3d_pipeline;
+static SDL_GPUGraphicsPipeline* graph_screen_pipeline;
+static SDL_GPUGraphicsPipeline* trail_2d_pipeline;
+static SDL_GPUGraphicsPipeline* trail_3d_pipeline;
+static SDL_GPUGraphicsPipeline* trail_screen_pipeline;
+static SDL_GPUGraphicsPipeline* sphere_2d_pipeline;
+static SDL_GPUGraphicsPipeline* sphere_3d_pipeline;
+static SDL_GPUGraphicsPipeline* grid_2d_pipeline;
+static SDL_GPUGraphicsPipeline* grid_3d_pipeline;
+static SDL_GPUGraphicsPipeline* grid_screen_pipeline;
+static SDL_GPUShader* vertex_shader;
+static SDL_GPUShader* fragment_shader;
+static SDL_GPUShader* point_vertex_shader;
+static SDL_GPUShader* trail_vertex_shader;
+static SDL_GPUShader* graph_vertex_shader;
+static SDL_GPUShader* label_vertex_shader;
+static SDL_GPUShader* sphere_vertex_shader;
+static SDL_GPUShader* sphere_fragment_shader;
+static SDL_GPUShader* grid_vertex_shader;
+static SDL_GPUShader* grid_fragment_shader;
+static SDL_GPUShader* fullscreen_vertex_shader;
+static SDL_GPUShader* translucent_fragment_shader;
+static SDL_GPUShader* resolve_fragment_shader;
+static SDL_GPUShader* composite_fragment_shader;
+static SDL_GPUShader* depth_fragment_shader;
+static SDL_GPUTextureFormat target_color_format;
+static SDL_GPUTextureFormat target_depth_format;
+
+/* Created by the first mesh with a layout and kept until SDL_QuitGPUD, for
+ * 2D, 3D and the screen slot */
+typedef struct
+{
+    Uint32 stride;
+    Uint32 offset;
+    SDL_GPUGraphicsPipeline* pipelines[3];
+} WireframePipeline;
+
+static WireframePipeline wireframe_pipelines[WIREFRAME_PIPELINES];
+static int num_wireframe_pipelines;
+
+/* The color of every cloud draw of a submit, bound per instance by
+ * wireframes */
+static SDL_GPUBuffer* cloud_colors;
+static SDL_GPUTransferBuffer* cloud_color_transfer;
+static int cloud_color_capacity;
+static Uint32 color;
+static Command* head;
+static Command* tail;
+static SDL_IOStream* capture;
+static SDL_IOStream* stream;
+
+/* Transforms of the frame being recorded, batches refer to them by index and
+ * zero is the identity */
+typedef struct
+{
+    float matrix[16];
+} Transform;
+
+static Transform* transforms;
+static int num_transforms = 1;
+static int transform_capacity;
+static int transform_stack[TRANSFORM_DEPTH];
+static int transform_depth;
+static int transform;
+static SDL_GPUDSlot slot;
+
+typedef enum
+{
+    CLOUD_TYPE_POINTS,
+    CLOUD_TYPE_GRID,
+    CLOUD_TYPE_GRAPH,
+    CLOUD_TYPE_TRAILS,
+    CLOUD_TYPE_MESH,
+} CloudType;
+
+/* Points are read by the point shader as a storage buffer. Grids, graphs,
+ * trails and meshes start with one to share the draw list */
+struct SDL_GPUDPointCloud
+{
+    SDL_GPUBuffer* buffer;
+    SDL_GPUBuffer* index_buffer;
+    Uint32 num_points;
+    bool owned;
+    CloudType type;
+};
+
+/* Grids have no buffer, every draw is a fullscreen triangle */
+struct SDL_GPUDGrid
+{
+    SDL_GPUDPointCloud cloud;
+    int levels;
+    float radius;
+};
+
+/* Positions are stored frame-major, so a push is one contiguous upload. The
+ * trail shader joins every slot to the next one for every trail */
+struct SDL_GPUDTrails
+{
+    SDL_GPUDPointCloud cloud;
+    SDL_GPUTransferBuffer* transfer_buffer;
+    SDL_GPUDVertex* positions;
+    Uint32 num_trails;
+    Uint32 length;
+    Uint64 written;
+    Uint64 uploaded;
+};
+
+/* The buffers of the cloud belong to the caller */
+struct SDL_GPUDMesh
+{
+    SDL_GPUDPointCloud cloud;
+    const WireframePipeline* pipeline;
+    SDL_GPUIndexElementSize index_size;
+};
+
+/* Values are uploaded as they are, the graph shader reads them from the
+ * oldest and takes x from the vertex index */
+struct SDL_GPUDGraph
+{
+    SDL_GPUDPointCloud cloud;
+    SDL_GPUTransferBuffer* transfer_buffer;
+    float* values;
+    Uint32 capacity;
+    Uint32 downsample;
+    Uint64 written;
+    Uint64 uploaded;
+    Uint32 color;
+    Uint32 bucket_size;
+    Uint32 bucket_min;
+    Uint32 bucket_max;
+    float min;
+    float max;
+};
+
+typedef struct
+{
+    SDL_GPUDPointCloud* cloud;
+    Uint32 stride;
+    Uint32 first;
+    Uint32 count;
+    int transform;
+    SDL_GPUDSlot slot;
+    Uint32 color;
+    float size;
+    float center[2]; /* Of the fade of grids */
+} CloudDraw;
+
+static CloudDraw* cloud_draws;
+static int num_cloud_draws;
+static int cloud_draw_capacity;
+static float custom_matrix[16] = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f,
+};
+
+/* The command headers of a submit followed by its vertex words */
+typedef struct
+{
+    Uint32* words;
+    Uint32 size;
+    Uint32 capacity;
+    Uint32 num_commands;
+} StreamBuffer;
+
+/* The producer and consumer positions are free-running and live on their own
+ * cache lines. Records are 16-byte aligned and never straddle the end of the
+ * ring, a padding record fills the remainder instead */
+typedef struct
+{
+    Uint32 magic;
+    Uint32 capacity;
+    Uint8 padding1[56];
+    SDL_AtomicU32 head;
+    Uint8 padding2[60];
+    SDL_AtomicU32 tail;
+    Uint8 padding3[60];
+} RingHeader;
+
+typedef struct
+{
+    Uint32 type;
+    Uint32 size;
+    Uint32 padding[2];
+} RingRecord;
+
+/* The capacity is read from the header once, the other process could change
+ * it */
+struct SDL_GPUDRing
+{
+    RingHeader* header;
+    Uint8* data;
+    size_t size;
+    Uint32 capacity;
+    char* name;
+#if defined(SDL_PLATFORM_WINDOWS)
+    HANDLE mapping;
+#endif
+};
+
+/* A recorded primitive, its bytes are at offset in the data of the set */
+typedef struct
+{
+    Uint64 hash;
+    Uint32 offset;
+    Uint32 size;
+    CommandType type;
+    int transform;
+    SDL_GPUDSlot slot;
+} HashEntry;
+
+/* Open addressing set of primitives, a zero hash marks an empty slot. Equal
+ * hashes are confirmed against a copy of the bytes */
+typedef struct
+{
+    HashEntry* entries;
+    Uint32 size;
+    Uint32 capacity;
+    Uint8* data;
+    Uint32 data_size;
+    Uint32 data_capacity;
+    int primitives;
+    int duplicates;
+    Uint32 bytes;
+} HashSet;
+
+/* Slots of the pool uploaded by one submit */
+typedef struct
+{
+    SDL_GPUFence* fence;
+    Uint32* slots;
+    int num_slots;
+} PoolFence;
+
+/* With a budget, batches take fixed size slots of one transfer buffer and one
+ * vertex buffer created in SDL_InitGPUD and split primitives across them. The
+ * slots of a submit are in flight until the fence of its upload signals */
+static Uint32 budget;
+static SDL_GPUDOverflow overflow;
+static int priority;
+static SDL_GPUTransferBuffer* pool_transfer_buffer;
+static SDL_GPUBuffer* pool_buffer;
+static Uint8* pool_data;
+static Uint32* pool;
+static int pool_size;
+static int pool_capacity;
+static PoolFence pool_fences[POOL_FENCES];
+static PoolFence* pool_fence;
+static Uint64 dropped_bytes;
+static Uint64 grown_bytes;
+
+/* The overlay is recreated whenever the viewport changes */
+static Uint32 overlay_scale = 1;
+static SDL_GPUTextureFormat overlay_format;
+static SDL_GPUTextureFormat overlay_depth_format;
+static SDL_GPUTexture* overlay_texture;
+static SDL_GPUTexture* overlay_depth_texture;
+static SDL_GPUSampler* overlay_sampler;
+static SDL_GPUSampler* overlay_depth_sampler;
+static Uint32 overlay_width;
+static Uint32 overlay_height;
+
+/* Weighted blended translucency: the weighted sum of premultiplied colors
+ * and the product of one minus alpha, recreated whenever the size of the
+ * color target changes */
+static SDL_GPUTexture* accum_texture;
+static SDL_GPUTexture* reveal_texture;
+static SDL_GPUSampler* blend_sampler;
+static Uint32 blend_width;
+static Uint32 blend_height;
+
+/* The counter doubles as the arguments of the indirect draw and is reset from
+ * a transfer buffer filled once in SDL_InitGPUD */
+static Uint32 append_capacity;
+static SDL_GPUBuffer* append_buffer;
+static SDL_GPUBuffer* append_counter;
+static SDL_GPUTransferBuffer* append_reset;
+
+static bool deduplicate;
+static HashSet hash_set;
+static HashSet last_hash_set;
+
+/* Batches of a previous submit whose GPU buffers are kept for reuse. The
+ * batches and the transforms they were recorded with share one allocation */
+typedef struct
+{
+    Uint64 hash;
+    Uint32 size;
+    Uint64 last_used;
+    Command* head;
+    Transform* transforms;
+    int num_transforms;
+} CachedFrame;
+
+static bool frame_cache;
+static Uint64 frame_hash;
+static Uint32 frame_size;
+static Uint64 frame_index;
+static CachedFrame cached_frames[CACHED_FRAMES];
+
+/* Command nodes of the frame being recorded come from blocks that are kept
+ * and reused by every following frame */
+typedef struct CommandBlock CommandBlock;
+typedef struct CommandBlock
+{
+    CommandBlock* next;
+    Command commands[ARENA_COMMANDS];
+} CommandBlock;
+
+static CommandBlock* arena_head;
+static CommandBlock* arena_block;
+static int arena_used;
+
+/* Threaded frames record into heap memory, a worker copies the sealed frame
+ * into transfer buffers while the next one is recorded into the other arena
+ * and transforms */
+typedef struct
+{
+    Command* head;
+    CommandBlock* arena;
+    Transform* transforms;
+    int transform_capacity;
+    CloudDraw* cloud_draws;
+    int num_cloud_draws;
+    int cloud_draw_capacity;
+    float matrix[16];
+    float custom[16];
+    Uint32 viewport[2];
+    bool pending;
+} SealedFrame;
+
+static bool threaded;
+static bool pack_quit;
+static SealedFrame sealed;
+static SDL_Thread* pack_thread;
+static SDL_Semaphore* pack_start;
+static SDL_Semaphore* pack_done;
+static SDL_malloc_func memory_malloc;
+static SDL_calloc_func memory_calloc;
+static SDL_realloc_func memory_realloc;
+static SDL_free_func memory_free;
+
+/* Translucent points and impostors are kept compact until submit, where
+ * translucent points are sorted and expanded after everything else */
+typedef struct
+{
+    SDL_GPUDVertex center;
+    float radius;
+} DeferredPoint;
+
+static SDL_GPUDTranslucency translucency;
+static DeferredPoint* translucents;
+static int num_translucents;
+static int translucent_capacity;
+static bool impostors;
+static DeferredPoint* impostor_points;
+static int num_impostor_points;
+static int impostor_capacity;
+static Uint64* sort_keys;
+static int sort_capacity;
+
+/* Labels are pushed at submit as one instance per glyph, which label.vert
+ * expands from the glyph table around the projected anchor. Without a build
+ * for the device, they are expanded once the matrix is known into lines that
+ * are already in normalized device coordinates */
+typedef struct
+{
+    SDL_GPUDVertex anchor;
+    int size;
+    bool occlude;
+    Uint32 text;
+} Label;
+
+static Label* labels;
+static int num_labels;
+static int label_capacity;
+static char* label_text;
+static Uint32 label_text_size;
+static Uint32 label_text_capacity;
+static Uint32 viewport_width;
+static Uint32 viewport_height;
+/* The caller's custom matrix and viewport while a captured frame is recorded,
+ * restored once it was submitted */
+static bool restore_pending;
+static float restore_custom[16];
+static Uint32 restore_viewport[2];
+static const Label* text_label;
+/* The strokes of every printable character, for label.vert. Each starts with
+ * the index of its first stroke and the number of strokes in the high half,
+ * then every stroke holds the column and row of its ends in a byte each. No
+ * glyph has more than 10 strokes */
+#define GLYPH_COUNT (0x7f - 0x20 + 1)
+#define GLYPH_SIZE 16
+#define GLYPH_MAX_STROKES 10
+static SDL_GPUBuffer* glyph_buffer;
+static Uint8 glyph_counts[GLYPH_COUNT];
+static Uint32* glyph_strokes;
+static int num_glyph_strokes;
+static float text_origin[3];
+static int text_wrap;
+static SDL_GPUDAlign text_align;
+static SDL_Rect text_clip;
+static bool text_clipped;
+
+/* Lines of a string relative to the origin, reused until it is the least
+ * recently drawn */
+typedef struct
+{
+    Uint64 hash;
+    char* text;
+    int length;
+    int size;
+    SDL_FPoint* points;
+    int num_points;
+    int capacity;
+    Uint64 last_used;
+} TextEntry;
+
+static TextEntry text_cache[TEXT_CACHE_ENTRIES];
+static TextEntry* text_entry;
+static bool text_failed;
+static Uint64 text_index;
+static Uint64 text_hits;
+static Uint64 text_misses;
+
+typedef enum
+{
+    SHAPE_TYPE_ARC,
+    SHAPE_TYPE_CYLINDER,
+    SHAPE_TYPE_CAPSULE,
+    SHAPE_TYPE_CONE,
+    SHAPE_TYPE_ARROW,
+    SHAPE_TYPE_FRUSTUM,
+} ShapeType;
+
+/* Arcs are (center, normal, radius, start, end), frusta an inverse matrix and
+ * everything else (start, end, radius) */
+typedef struct
+{
+    ShapeType type;
+    Uint32 color;
+    int transform;
+    SDL_GPUDSlot slot;
+    float params[16];
+} Shape;
+
+static Shape* shapes;
+static int num_shapes;
+static int shape_capacity;
+static int shape_detail = 32;
+
+/* Points of an arc are center + cos(angle) * u + sin(angle) * v. Matches
+ * four vec4 of u_arcs in shape.comp */
+typedef struct
+{
+    float center[3];
+    Uint32 color;
+    float u[3];
+    float start;
+    float v[3];
+    float end;
+    Uint32 segments;
+    Uint32 transform;
+    Uint32 slot;
+    Uint32 padding;
+} ShapeArc;
+
+static ShapeArc* shape_arcs;
+static int num_shape_arcs;
+static int shape_arc_capacity;
+static Uint32 shape_vertices[3];
+static SDL_GPUComputePipeline* shape_pipeline;
+static SDL_GPUBuffer* shape_arc_buffer;
+static SDL_GPUBuffer* shape_transform_buffer;
+static SDL_GPUBuffer* shape_vertex_buffer;
+static SDL_GPUBuffer* shape_draw_buffer;
+static SDL_GPUTransferBuffer* shape_transfer_buffer;
+static Uint32 shape_arc_size;
+static Uint32 shape_transform_size;
+static Uint32 shape_vertex_size;
+static Uint32 shape_transfer_size;
+
+static StreamBuffer stream_send;
+static StreamBuffer stream_receive;
+static StreamBuffer stream_decode;
+static StreamBuffer stream_scratch;
+
+/* Capture files are native-endian and every field is 4-byte aligned so that
+ * a mapped file can be handed to PushCommand without any decoding */
+typedef struct
+{
+    Uint32 magic;
+    Uint32 version;
+} CaptureHeader;
+
+typedef struct
+{
+    Uint32 size; /* Bytes following this field, up to the next frame */
+    Uint32 flags;
+    Uint32 num_commands;
+    float matrix[16];
+    float custom[16];
+    Uint32 viewport[2];
+} CaptureFrame;
+
+typedef struct
+{
+    Uint32 type;
+    Uint32 size;
+} CaptureCommand;
+
+struct SDL_GPUDReplay
+{
+    const Uint8* data;
+    size_t size;
+    int num_frames;
+    const CaptureFrame** frames;
+#if defined(SDL_PLATFORM_WINDOWS)
+    HANDLE file;
+    HANDLE mapping;
+#endif
+};
+
+static void* Malloc(
+    const size_t size)
+{
+    return memory_malloc ? memory_malloc(size) : SDL_malloc(size);
+}
+
+static void* Calloc(
+    const size_t count,
+    const size_t size)
+{
+    return memory_calloc ? memory_calloc(count, size) : SDL_calloc(count, size);
+}
+
+static void* Realloc(
+    void* data,
+    const size_t size)
+{
+    return memory_realloc ? memory_realloc(data, size) : SDL_realloc(data, size);
+}
+
+static void Free(
+    void* data)
+{
+    if (memory_free) {
+        memory_free(data);
+    } else {
+        SDL_free(data);
+    }
+}
+
+bool SDL_SetGPUDMemoryFunctions(
+    SDL_malloc_func malloc_func,
+    SDL_calloc_func calloc_func,
+    SDL_realloc_func realloc_func,
+    SDL_free_func free_func)
+{
+    if (device) {
+        return SDL_SetError("Cannot change the memory functions after SDL_InitGPUD");
+    }
+    if (!malloc_func) {
+        return SDL_InvalidParamError("malloc_func");
+    }
+    if (!calloc_func) {
+        return SDL_InvalidParamError("calloc_func");
+    }
+    if (!realloc_func) {
+        return SDL_InvalidParamError("realloc_func");
+    }
+    if (!free_func) {
+        return SDL_InvalidParamError("free_func");
+    }
+    memory_malloc = malloc_func;
+    memory_calloc = calloc_func;
+    memory_realloc = realloc_func;
+    memory_free = free_func;
+    return true;
+}
+
+bool SDL_SetGPUDThreaded(
+    const bool enabled)
+{
+    if (device) {
+        return SDL_SetError("Cannot change threading after SDL_InitGPUD");
+    }
+    if (enabled && budget) {
+        return SDL_SetError("Threading cannot be combined with a budget");
+    }
+    threaded = enabled;
+    return true;
+}
+
+bool SDL_SetGPUDAppendCapacity(
+    const Uint32 num_vertices)
+{
+    if (device) {
+        return SDL_SetError("Cannot change the append capacity after SDL_InitGPUD");
+    }
+    append_capacity = num_vertices;
+    return true;
+}
+
+bool SDL_SetGPUDOverlay(
+    const Uint32 scale,
+    const SDL_GPUTextureFormat format)
+{
+    if (device) {
+        return SDL_SetError("Cannot change the overlay after SDL_InitGPUD");
+    }
+    if (!scale) {
+        return SDL_InvalidParamError("scale");
+    }
+    overlay_scale = scale;
+    overlay_format = format;
+    return true;
+}
+
+/* Column major, out may not alias a or b */
+static void MultiplyMatrix(
+    float* out,
+    const float* a,
+    const float* b)
+{
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            out[i * 4 + j] = a[j] * b[i * 4] + a[j + 4] * b[i * 4 + 1] +
+                a[j + 8] * b[i * 4 + 2] + a[j + 12] * b[i * 4 + 3];
+        }
+    }
+}
+
+/* Gauss-Jordan elimination with partial pivoting, false if singular */
+static bool InvertMatrix(
+    float* out,
+    const float* matrix)
+{
+    float a[4][8];
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            a[i][j] = matrix[j * 4 + i];
+            a[i][j + 4] = i == j;
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        int pivot = i;
+        for (int j = i + 1; j < 4; j++) {
+            if (SDL_fabsf(a[j][i]) > SDL_fabsf(a[pivot][i])) {
+                pivot = j;
+            }
+        }
+        if (a[pivot][i] == 0.0f) {
+            return false;
+        }
+        for (int j = 0; j < 8; j++) {
+            const float temp = a[i][j];
+            a[i][j] = a[pivot][j];
+            a[pivot][j] = temp;
+        }
+        const float scale = 1.0f / a[i][i];
+        for (int j = 0; j < 8; j++) {
+            a[i][j] *= scale;
+        }
+        for (int j = 0; j < 4; j++) {
+            const float factor = a[j][i];
+            if (j == i || factor == 0.0f) {
+                continue;
+            }
+            for (int k = 0; k < 8; k++) {
+                a[j][k] -= factor * a[i][k];
+            }
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            out[j * 4 + i] = a[i][j + 4];
+        }
+    }
+    return true;
+}
+
+/* Also used by primitives kept compact until submit, which apply the
+ * current transform to their position right away */
+static void TransformPoint(
+    SDL_GPUDVertex* vertex,
+    const int index)
+{
+    if (!index) {
+        return;
+    }
+    const float* m = transforms[index].matrix;
+    const float x = vertex->x;
+    const float y = vertex->y;
+    const float z = vertex->z;
+    vertex->x = m[0] * x + m[4] * y + m[8] * z + m[12];
+    vertex->y = m[1] * x + m[5] * y + m[9] * z + m[13];
+    vertex->z = m[2] * x + m[6] * y + m[10] * z + m[14];
+}
+
+/* Captures and streams are replayed without transforms, so they store the
+ * transformed vertices of the bytes [offset, offset + size) */
+static void BakeTransform(
+    const Command* command,
+    const Uint32 offset,
+    const Uint32 size,
+    Uint8* data)
+{
+    const float* m = transforms[command->transform].matrix;
+    if (command->type == COMMAND_TYPE_OVERLAY) {
+        for (Uint32 i = 0; i < size; i += sizeof(OverlayVertex)) {
+            OverlayVertex vertex;
+            SDL_memcpy(&vertex, command->data + offset + i, sizeof(vertex));
+            const float x = vertex.x;
+            const float y = vertex.y;
+            vertex.x = m[0] * x + m[4] * y + m[12];
+            vertex.y = m[1] * x + m[5] * y + m[13];
+            SDL_memcpy(data + i, &vertex, sizeof(vertex));
+        }
+        return;
+    }
+    for (Uint32 i = 0; i < size; i += sizeof(SDL_GPUDVertex)) {
+        SDL_GPUDVertex vertex;
+        SDL_memcpy(&vertex, command->data + offset + i, sizeof(vertex));
+        TransformPoint(&vertex, command->transform);
+        SDL_memcpy(data + i, &vertex, sizeof(vertex));
+    }
+}
+
+static Command* AllocateCommand()
+{
+    if (!arena_block || arena_used == ARENA_COMMANDS) {
+        CommandBlock* block = arena_block ? arena_block->next : arena_head;
+        if (!block) {
+            block = Malloc(sizeof(CommandBlock));
+            if (!block) {
+                return NULL;
+            }
+            block->next = NULL;
+            if (arena_block) {
+                arena_block->next = block;
+            } else {
+                arena_head = block;
+            }
+        }
+        arena_block = block;
+        arena_used = 0;
+    }
+    return &arena_block->commands[arena_used++];
+}
+
+static int SDLCALL PackFrames(
+    void* userdata)
+{
+    while (true) {
+        SDL_WaitSemaphore(pack_start);
+        if (pack_quit) {
+            return 0;
+        }
+        for (Command* command = sealed.head; command; command = command->next) {
+            SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+            transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+            transfer_buffer_info.size = command->size;
+            command->transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+            void* data = NULL;
+            if (command->transfer_buffer) {
+                data = SDL_MapGPUTransferBuffer(device, command->transfer_buffer, false);
+            }
+            if (data) {
+                SDL_memcpy(data, command->data, command->size);
+                SDL_UnmapGPUTransferBuffer(device, command->transfer_buffer);
+            } else {
+                SDL_ReleaseGPUTransferBuffer(device, command->transfer_buffer);
+                command->transfer_buffer = NULL;
+            }
+            Free(command->data);
+            command->data = NULL;
+        }
+        SDL_SignalSemaphore(pack_done);
+    }
+}
+
+static void ResetAppendBuffer(
+    SDL_GPUCommandBuffer* command_buffer)
+{
+    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    if (!copy_pass) {
+        return;
+    }
+    SDL_GPUTransferBufferLocation location = {0};
+    SDL_GPUBufferRegion region = {0};
+    location.transfer_buffer = append_reset;
+    region.buffer = append_counter;
+    region.size = sizeof(SDL_GPUIndirectDrawCommand);
+    SDL_UploadToGPUBuffer(copy_pass, &location, &region, false);
+    SDL_EndGPUCopyPass(copy_pass);
+}
+
+/* The builds of a shader for every format. Builds missing from
+ * SDL_gpud_shaders.h are empty until build_shaders.sh is rerun */
+typedef struct
+{
+    const Uint8* spv;
+    size_t spv_len;
+    const Uint8* dxil;
+    size_t dxil_len;
+    const Uint8* msl;
+    size_t msl_len;
+} ShaderCode;
+
+#define SHADER_CODE(name) (const ShaderCode) { \
+    name##_spv, name##_spv_len, name##_dxil, name##_dxil_len, name##_msl, name##_msl_len}
+
+static bool GetShaderCode(
+    const ShaderCode* code,
+    const Uint8** data,
+    size_t* size,
+    const char** entrypoint,
+    SDL_GPUShaderFormat* format)
+{
+    const SDL_GPUShaderFormat formats = SDL_GetGPUShaderFormats(device);
+    if (formats & SDL_GPU_SHADERFORMAT_SPIRV) {
+        *data = code->spv;
+        *size = code->spv_len;
+        *entrypoint = "main";
+        *format = SDL_GPU_SHADERFORMAT_SPIRV;
+    } else if (formats & SDL_GPU_SHADERFORMAT_DXIL) {
+        *data = code->dxil;
+        *size = code->dxil_len;
+        *entrypoint = "main";
+        *format = SDL_GPU_SHADERFORMAT_DXIL;
+    } else if (formats & SDL_GPU_SHADERFORMAT_MSL) {
+        *data = code->msl;
+        *size = code->msl_len;
+        *entrypoint = "main0";
+        *format = SDL_GPU_SHADERFORMAT_MSL;
+    } else {
+        *size = 0;
+    }
+    return *size != 0;
+}
+
+static bool HasShader(
+    const ShaderCode* code)
+{
+    const Uint8* data;
+    size_t size;
+    const char* entrypoint;
+    SDL_GPUShaderFormat format;
+    return GetShaderCode(code, &data, &size, &entrypoint, &format);
+}
+
+static SDL_GPUShader* CreateShader(
+    const ShaderCode* code,
+    const SDL_GPUShaderStage stage,
+    const Uint32 num_samplers,
+    const Uint32 num_storage_buffers,
+    const Uint32 num_uniform_buffers)
+{
+    SDL_GPUShaderCreateInfo info = {0};
+    if (!GetShaderCode(code, &info.code, &info.code_size, &info.entrypoint, &info.format)) {
+        SDL_SetError("Missing shader build, rerun build_shaders.sh");
+        return NULL;
+    }
+    info.stage = stage;
+    info.num_samplers = num_samplers;
+    info.num_storage_buffers = num_storage_buffers;
+    info.num_uniform_buffers = num_uniform_buffers;
+    return SDL_CreateGPUShader(device, &info);
+}
+
+/* The overlay keeps the coverage in alpha for the composite */
+static SDL_GPUBlendFactor GetAlphaBlendFactor()
+{
+    return overlay_scale > 1 ? SDL_GPU_BLENDFACTOR_ONE : SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+}
+
+static void DecodeText(
+    const char* text,
+    const int length,
+    const int x,
+    const int y,
+    const int size);
+
+/* Decodes every character once at GLYPH_SIZE into the glyph table */
+static bool UploadGlyphs()
+{
+    Uint32 glyphs[GLYPH_COUNT * (GLYPH_MAX_STROKES + 1)] = {0};
+    Uint32 size = GLYPH_COUNT;
+    /* The decoder has no segments for the last character */
+    for (int i = 0; i < GLYPH_COUNT - 1; i++) {
+        const char c = (char) (0x20 + i);
+        glyph_strokes = &glyphs[size];
+        num_glyph_strokes = 0;
+        DecodeText(&c, 1, 0, 0, GLYPH_SIZE);
+        glyphs[i] = size | num_glyph_strokes << 16;
+        glyph_counts[i] = num_glyph_strokes;
+        size += num_glyph_strokes;
+    }
+    glyph_strokes = NULL;
+    SDL_GPUBufferCreateInfo buffer_info = {0};
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
+    buffer_info.size = size * sizeof(Uint32);
+    glyph_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+    SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+    transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer_info.size = buffer_info.size;
+    SDL_GPUTransferBuffer* transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+    void* data = NULL;
+    if (glyph_buffer && transfer_buffer) {
+        data = SDL_MapGPUTransferBuffer(device, transfer_buffer, false);
+    }
+    SDL_GPUCommandBuffer* command_buffer = NULL;
+    if (data) {
+        SDL_memcpy(data, glyphs, buffer_info.size);
+        SDL_UnmapGPUTransferBuffer(device, transfer_buffer);
+        command_buffer = SDL_AcquireGPUCommandBuffer(device);
+    }
+    SDL_GPUCopyPass* copy_pass = NULL;
+    if (command_buffer) {
+        copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    }
+    if (copy_pass) {
+        SDL_GPUTransferBufferLocation location = {0};
+        SDL_GPUBufferRegion region = {0};
+        location.transfer_buffer = transfer_buffer;
+        region.buffer = glyph_buffer;
+        region.size = buffer_info.size;
+        SDL_UploadToGPUBuffer(copy_pass, &location, &region, false);
+        SDL_EndGPUCopyPass(copy_pass);
+    }
+    const bool status = command_buffer && SDL_SubmitGPUCommandBuffer(command_buffer) && copy_pass;
+    SDL_ReleaseGPUTransferBuffer(device, transfer_buffer);
+    return status;
+}
+
+bool SDL_InitGPUD(
     SDL_GPUDevice* handle,
     const SDL_GPUTextureFormat color_format,
     const SDL_GPUTextureFormat depth_format)
 {
-    if (device) {
-        SDL_QuitGPUD();
+    if (device) {
+        SDL_QuitGPUD();
+    }
+    device = handle;
+    if (!device) {
+        return SDL_InvalidParamError("device");
+    }
+    if (!(SDL_GetGPUShaderFormats(device) & (SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL |
+            SDL_GPU_SHADERFORMAT_MSL))) {
+        return SDL_Unsupported();
+    }
+    fragment_shader = CreateShader(&SHADER_CODE(shader_frag), SDL_GPU_SHADERSTAGE_FRAGMENT, 0, 0, 0);
+    vertex_shader = CreateShader(&SHADER_CODE(shader_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 0, 1);
+    if (!fragment_shader || !vertex_shader) {
+        goto error;
+    }
+    if (overlay_scale > 1) {
+        if (overlay_format == SDL_GPU_TEXTUREFORMAT_INVALID) {
+            overlay_format = color_format;
+        }
+        overlay_depth_format = depth_format;
+    }
+    target_color_format = overlay_scale > 1 ? overlay_format : color_format;
+    target_depth_format = depth_format;
+    SDL_GPUColorTargetDescription color_target = {
+        .format = target_color_format,
+        .blend_state = {
+            .enable_blend = true,
+            .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+            .color_blend_op = SDL_GPU_BLENDOP_ADD,
+            .src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
+            .src_alpha_blendfactor = GetAlphaBlendFactor(),
+            .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+        },
+    };
+    SDL_GPUGraphicsPipelineCreateInfo pipeline_info = {
+        .vertex_shader = vertex_shader,
+        .fragment_shader = fragment_shader,
+        .target_info = {
+            .num_color_targets = 1,
+            .color_target_descriptions = &color_target,
+            .depth_stencil_format = depth_format,
+        },
+        .vertex_input_state = {
+            .num_vertex_attributes = 2,
+            .vertex_attributes = (SDL_GPUVertexAttribute[]) {{
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                .location = 0,
+                .offset = 0,
+            }, {
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+                .location = 1,
+                .offset = 12,
+            }},
+            .num_vertex_buffers = 1,
+            .vertex_buffer_descriptions = (SDL_GPUVertexBufferDescription[]) {{
+                .pitch = 16,
+            }},
+        },
+        .depth_stencil_state = {
+            .compare_op = SDL_GPU_COMPAREOP_LESS,
+            .enable_depth_test = true,
+            .enable_depth_write = true,
+        }
+    };
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST;
+    pipeline_info.target_info.has_depth_stencil_target = false;
+    line_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST;
+    pipeline_info.target_info.has_depth_stencil_target = true;
+    line_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+    pipeline_info.target_info.has_depth_stencil_target = false;
+    poly_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+    pipeline_info.target_info.has_depth_stencil_target = true;
+    poly_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    if (!line_2d_pipeline || !line_3d_pipeline || !poly_2d_pipeline || !poly_3d_pipeline) {
+        goto error;
+    }
+    const SDL_GPUVertexInputState vertex_input_state = pipeline_info.vertex_input_state;
+    pipeline_info.vertex_input_state.vertex_attributes = (SDL_GPUVertexAttribute[]) {{
+        .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
+        .location = 0,
+        .offset = 0,
+    }, {
+        .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+        .location = 1,
+        .offset = 8,
+    }};
+    pipeline_info.vertex_input_state.vertex_buffer_descriptions = (SDL_GPUVertexBufferDescription[]) {{
+        .pitch = sizeof(OverlayVertex),
+    }};
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST;
+    pipeline_info.target_info.has_depth_stencil_target = false;
+    overlay_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    pipeline_info.target_info.has_depth_stencil_target = true;
+    overlay_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    /* The screen slot is drawn on top of a submit with a depth texture */
+    pipeline_info.depth_stencil_state.enable_depth_test = false;
+    pipeline_info.depth_stencil_state.enable_depth_write = false;
+    overlay_screen_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    if (!overlay_2d_pipeline || !overlay_3d_pipeline || !overlay_screen_pipeline) {
+        goto error;
+    }
+    pipeline_info.depth_stencil_state.enable_depth_test = true;
+    pipeline_info.vertex_input_state = vertex_input_state;
+    /* Labels are drawn on top, or tested but never written when occluded */
+    pipeline_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL;
+    pipeline_info.depth_stencil_state.enable_depth_write = false;
+    label_occluded_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    pipeline_info.depth_stencil_state.enable_depth_test = false;
+    label_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+    poly_screen_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    if (!label_pipeline || !label_occluded_pipeline || !poly_screen_pipeline) {
+        goto error;
+    }
+    /* Glyphs are instanced lines from the glyph table around the anchor of
+     * their label. Without a build for the device, labels are lines instead */
+    if (HasShader(&SHADER_CODE(label_vert))) {
+        label_vertex_shader = CreateShader(&SHADER_CODE(label_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 1, 2);
+        if (!label_vertex_shader) {
+            goto error;
+        }
+        SDL_GPUGraphicsPipelineCreateInfo glyph_info = pipeline_info;
+        glyph_info.vertex_shader = label_vertex_shader;
+        glyph_info.vertex_input_state.num_vertex_attributes = 4;
+        glyph_info.vertex_input_state.vertex_attributes = (SDL_GPUVertexAttribute[]) {{
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+            .location = 0,
+            .offset = 0,
+        }, {
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+            .location = 1,
+            .offset = 12,
+        }, {
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
+            .location = 2,
+            .offset = 16,
+        }, {
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+            .location = 3,
+            .offset = 28,
+        }};
+        glyph_info.vertex_input_state.vertex_buffer_descriptions = (SDL_GPUVertexBufferDescription[]) {{
+            .pitch = 2 * sizeof(SDL_GPUDVertex),
+            .input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE,
+        }};
+        glyph_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST;
+        glyph_pipeline = SDL_CreateGPUGraphicsPipeline(device, &glyph_info);
+        glyph_info.depth_stencil_state.enable_depth_test = true;
+        glyph_occluded_pipeline = SDL_CreateGPUGraphicsPipeline(device, &glyph_info);
+        glyph_info.target_info.has_depth_stencil_target = false;
+        glyph_info.depth_stencil_state.enable_depth_test = false;
+        glyph_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &glyph_info);
+        if (!glyph_pipeline || !glyph_occluded_pipeline || !glyph_2d_pipeline || !UploadGlyphs()) {
+            goto error;
+        }
+    }
+    /* Points are quads pulled from the cloud buffer by instance. Without a
+     * build for the device, clouds report an error instead */
+    if (HasShader(&SHADER_CODE(point_vert))) {
+        point_vertex_shader = CreateShader(&SHADER_CODE(point_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 1, 2);
+        if (!point_vertex_shader) {
+            goto error;
+        }
+        SDL_GPUGraphicsPipelineCreateInfo point_info = pipeline_info;
+        point_info.vertex_shader = point_vertex_shader;
+        point_info.vertex_input_state = (SDL_GPUVertexInputState) {0};
+        point_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP;
+        point_screen_pipeline = SDL_CreateGPUGraphicsPipeline(device, &point_info);
+        point_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
+        point_info.depth_stencil_state.enable_depth_test = true;
+        point_info.depth_stencil_state.enable_depth_write = true;
+        point_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &point_info);
+        point_info.target_info.has_depth_stencil_target = false;
+        point_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &point_info);
+        if (!point_2d_pipeline || !point_3d_pipeline || !point_screen_pipeline) {
+            goto error;
+        }
+    }
+    /* Impostors are instanced quads bounding every sphere, which the fragment
+     * shader ray-casts. Without a build for the device, points stay cubes */
+    if (HasShader(&SHADER_CODE(sphere_vert)) && HasShader(&SHADER_CODE(sphere_frag))) {
+        sphere_vertex_shader = CreateShader(&SHADER_CODE(sphere_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 0, 1);
+        sphere_fragment_shader = CreateShader(&SHADER_CODE(sphere_frag), SDL_GPU_SHADERSTAGE_FRAGMENT, 0, 0, 1);
+        if (!sphere_vertex_shader || !sphere_fragment_shader) {
+            goto error;
+        }
+        SDL_GPUGraphicsPipelineCreateInfo sphere_info = pipeline_info;
+        sphere_info.vertex_shader = sphere_vertex_shader;
+        sphere_info.fragment_shader = sphere_fragment_shader;
+        sphere_info.vertex_input_state.num_vertex_attributes = 3;
+        sphere_info.vertex_input_state.vertex_attributes = (SDL_GPUVertexAttribute[]) {{
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+            .location = 0,
+            .offset = 0,
+        }, {
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+            .location = 1,
+            .offset = 12,
+        }, {
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT,
+            .location = 2,
+            .offset = 16,
+        }};
+        sphere_info.vertex_input_state.vertex_buffer_descriptions = (SDL_GPUVertexBufferDescription[]) {{
+            .pitch = 2 * sizeof(SDL_GPUDVertex),
+            .input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE,
+        }};
+        sphere_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP;
+        sphere_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
+        sphere_info.depth_stencil_state.enable_depth_test = true;
+        sphere_info.depth_stencil_state.enable_depth_write = true;
+        sphere_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &sphere_info);
+        sphere_info.target_info.has_depth_stencil_target = false;
+        sphere_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &sphere_info);
+        if (!sphere_2d_pipeline || !sphere_3d_pipeline) {
+            goto error;
+        }
+    }
+    /* Grids are a fullscreen triangle that the fragment shader intersects
+     * with the plane. Without a build for the device, they fail to create */
+    if (HasShader(&SHADER_CODE(grid_vert)) && HasShader(&SHADER_CODE(grid_frag))) {
+        grid_vertex_shader = CreateShader(&SHADER_CODE(grid_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 0, 0);
+        grid_fragment_shader = CreateShader(&SHADER_CODE(grid_frag), SDL_GPU_SHADERSTAGE_FRAGMENT, 0, 0, 1);
+        if (!grid_vertex_shader || !grid_fragment_shader) {
+            goto error;
+        }
+        SDL_GPUGraphicsPipelineCreateInfo grid_info = pipeline_info;
+        grid_info.vertex_shader = grid_vertex_shader;
+        grid_info.fragment_shader = grid_fragment_shader;
+        grid_info.vertex_input_state = (SDL_GPUVertexInputState) {0};
+        grid_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+        grid_info.depth_stencil_state.enable_depth_test = false;
+        grid_info.depth_stencil_state.enable_depth_write = false;
+        grid_screen_pipeline = SDL_CreateGPUGraphicsPipeline(device, &grid_info);
+        grid_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
+        grid_info.depth_stencil_state.enable_depth_test = true;
+        grid_info.depth_stencil_state.enable_depth_write = true;
+        grid_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &grid_info);
+        grid_info.target_info.has_depth_stencil_target = false;
+        grid_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &grid_info);
+        if (!grid_2d_pipeline || !grid_3d_pipeline || !grid_screen_pipeline) {
+            goto error;
+        }
+    }
+    /* Shapes are expanded into lines by a compute pass with an indirect draw
+     * per slot. Without a build for the device, the CPU expands them */
+    if (HasShader(&SHADER_CODE(shape_comp))) {
+        SDL_GPUComputePipelineCreateInfo shape_info = {0};
+        GetShaderCode(&SHADER_CODE(shape_comp), &shape_info.code, &shape_info.code_size, &shape_info.entrypoint,
+            &shape_info.format);
+        shape_info.num_readonly_storage_buffers = 2;
+        shape_info.num_readwrite_storage_buffers = 2;
+        shape_info.num_uniform_buffers = 1;
+        shape_info.threadcount_x = 64;
+        shape_info.threadcount_y = 1;
+        shape_info.threadcount_z = 1;
+        shape_pipeline = SDL_CreateGPUComputePipeline(device, &shape_info);
+        SDL_GPUBufferCreateInfo buffer_info = {0};
+        buffer_info.usage = SDL_GPU_BUFFERUSAGE_INDIRECT | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ |
+            SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE;
+        buffer_info.size = 3 * sizeof(SDL_GPUIndirectDrawCommand);
+        shape_draw_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+        if (!shape_pipeline || !shape_draw_buffer) {
+            goto error;
+        }
+    }
+    /* Graphs are a line strip through the samples pulled from the history by
+     * vertex. Without a build for the device, graphs report an error instead */
+    if (HasShader(&SHADER_CODE(graph_vert))) {
+        graph_vertex_shader = CreateShader(&SHADER_CODE(graph_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 1, 2);
+        if (!graph_vertex_shader) {
+            goto error;
+        }
+        SDL_GPUGraphicsPipelineCreateInfo graph_info = pipeline_info;
+        graph_info.vertex_shader = graph_vertex_shader;
+        graph_info.vertex_input_state = (SDL_GPUVertexInputState) {0};
+        graph_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINESTRIP;
+        graph_screen_pipeline = SDL_CreateGPUGraphicsPipeline(device, &graph_info);
+        graph_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
+        graph_info.depth_stencil_state.enable_depth_test = true;
+        graph_info.depth_stencil_state.enable_depth_write = true;
+        graph_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &graph_info);
+        graph_info.target_info.has_depth_stencil_target = false;
+        graph_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &graph_info);
+        if (!graph_2d_pipeline || !graph_3d_pipeline || !graph_screen_pipeline) {
+            goto error;
+        }
+    }
+    /* Trails are segments pulled from the history by vertex and faded by
+     * their age. Without a build for the device, trails report an error
+     * instead */
+    if (HasShader(&SHADER_CODE(trail_vert))) {
+        trail_vertex_shader = CreateShader(&SHADER_CODE(trail_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 1, 2);
+        if (!trail_vertex_shader) {
+            goto error;
+        }
+        SDL_GPUGraphicsPipelineCreateInfo trail_info = pipeline_info;
+        trail_info.vertex_shader = trail_vertex_shader;
+        trail_info.vertex_input_state = (SDL_GPUVertexInputState) {0};
+        trail_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST;
+        trail_screen_pipeline = SDL_CreateGPUGraphicsPipeline(device, &trail_info);
+        trail_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
+        trail_info.depth_stencil_state.enable_depth_test = true;
+        trail_info.depth_stencil_state.enable_depth_write = true;
+        trail_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &trail_info);
+        trail_info.target_info.has_depth_stencil_target = false;
+        trail_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &trail_info);
+        if (!trail_2d_pipeline || !trail_3d_pipeline || !trail_screen_pipeline) {
+            goto error;
+        }
+    }
+    /* Blended translucency accumulates into targets of its own, tested
+     * against the depth of the opaque primitives, and resolves them onto the
+     * color target. Without a build for the device, it falls back to sorting */
+    if (HasShader(&SHADER_CODE(fullscreen_vert))) {
+        fullscreen_vertex_shader = CreateShader(&SHADER_CODE(fullscreen_vert), SDL_GPU_SHADERSTAGE_VERTEX, 0, 0, 0);
+        if (!fullscreen_vertex_shader) {
+            goto error;
+        }
+    }
+    if (fullscreen_vertex_shader && HasShader(&SHADER_CODE(translucent_frag)) &&
+        HasShader(&SHADER_CODE(resolve_frag))) {
+        translucent_fragment_shader = CreateShader(&SHADER_CODE(translucent_frag), SDL_GPU_SHADERSTAGE_FRAGMENT,
+            0, 0, 0);
+        resolve_fragment_shader = CreateShader(&SHADER_CODE(resolve_frag), SDL_GPU_SHADERSTAGE_FRAGMENT, 2, 0, 0);
+        if (!translucent_fragment_shader || !resolve_fragment_shader) {
+            goto error;
+        }
+        SDL_GPUColorTargetDescription blend_targets[2] = {{
+            .format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT,
+            .blend_state = {
+                .enable_blend = true,
+                .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+                .color_blend_op = SDL_GPU_BLENDOP_ADD,
+                .src_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                .src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+            },
+        }, {
+            .format = SDL_GPU_TEXTUREFORMAT_R16_FLOAT,
+            .blend_state = {
+                .enable_blend = true,
+                .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+                .color_blend_op = SDL_GPU_BLENDOP_ADD,
+                .src_color_blendfactor = SDL_GPU_BLENDFACTOR_ZERO,
+                .src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ZERO,
+                .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_COLOR,
+                .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            },
+        }};
+        SDL_GPUGraphicsPipelineCreateInfo blend_info = pipeline_info;
+        blend_info.fragment_shader = translucent_fragment_shader;
+        blend_info.target_info.num_color_targets = 2;
+        blend_info.target_info.color_target_descriptions = blend_targets;
+        blend_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+        blend_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
+        blend_info.depth_stencil_state.enable_depth_test = true;
+        blend_info.depth_stencil_state.enable_depth_write = false;
+        translucent_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &blend_info);
+        blend_info.target_info.has_depth_stencil_target = false;
+        translucent_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &blend_info);
+        /* dst * reveal + average * (1 - reveal) with the usual blend */
+        SDL_GPUGraphicsPipelineCreateInfo resolve_info = pipeline_info;
+        resolve_info.vertex_shader = fullscreen_vertex_shader;
+        resolve_info.fragment_shader = resolve_fragment_shader;
+        resolve_info.vertex_input_state = (SDL_GPUVertexInputState) {0};
+        resolve_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+        resolve_info.depth_stencil_state.enable_depth_test = false;
+        resolve_info.depth_stencil_state.enable_depth_write = false;
+        resolve_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &resolve_info);
+        resolve_info.target_info.has_depth_stencil_target = false;
+        resolve_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &resolve_info);
+        SDL_GPUSamplerCreateInfo sampler_info = {0};
+        sampler_info.min_filter = SDL_GPU_FILTER_NEAREST;
+        sampler_info.mag_filter = SDL_GPU_FILTER_NEAREST;
+        sampler_info.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST;
+        sampler_info.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        sampler_info.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        sampler_info.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        blend_sampler = SDL_CreateGPUSampler(device, &sampler_info);
+        if (!translucent_2d_pipeline || !translucent_3d_pipeline || !resolve_2d_pipeline ||
+            !resolve_3d_pipeline || !blend_sampler) {
+            goto error;
+        }
+    }
+    /* The overlay is composited over the color texture by every submit and
+     * tested against the farthest depth of every block of the caller's */
+    if (overlay_scale > 1) {
+        if (!fullscreen_vertex_shader) {
+            SDL_SetError("Missing overlay shader build, rerun build_shaders.sh");
+            goto error;
+        }
+        composite_fragment_shader = CreateShader(&SHADER_CODE(composite_frag), SDL_GPU_SHADERSTAGE_FRAGMENT, 1, 0, 1);
+        depth_fragment_shader = CreateShader(&SHADER_CODE(depth_frag), SDL_GPU_SHADERSTAGE_FRAGMENT, 1, 0, 1);
+        if (!composite_fragment_shader || !depth_fragment_shader) {
+            goto error;
+        }
+        SDL_GPUColorTargetDescription composite_target = {
+            .format = color_format,
+            .blend_state = {
+                .enable_blend = true,
+                .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+                .color_blend_op = SDL_GPU_BLENDOP_ADD,
+                .src_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                .src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            },
+        };
+        SDL_GPUGraphicsPipelineCreateInfo composite_info = {
+            .vertex_shader = fullscreen_vertex_shader,
+            .fragment_shader = composite_fragment_shader,
+            .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+            .target_info = {
+                .num_color_targets = 1,
+                .color_target_descriptions = &composite_target,
+            },
+        };
+        composite_pipeline = SDL_CreateGPUGraphicsPipeline(device, &composite_info);
+        if (!composite_pipeline) {
+            goto error;
+        }
+        if (depth_format != SDL_GPU_TEXTUREFORMAT_INVALID) {
+            composite_info.fragment_shader = depth_fragment_shader;
+            composite_info.target_info.num_color_targets = 0;
+            composite_info.target_info.has_depth_stencil_target = true;
+            composite_info.target_info.depth_stencil_format = depth_format;
+            composite_info.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_ALWAYS;
+            composite_info.depth_stencil_state.enable_depth_test = true;
+            composite_info.depth_stencil_state.enable_depth_write = true;
+            overlay_depth_pipeline = SDL_CreateGPUGraphicsPipeline(device, &composite_info);
+            if (!overlay_depth_pipeline) {
+                goto error;
+            }
+        }
+        SDL_GPUSamplerCreateInfo sampler_info = {0};
+        sampler_info.min_filter = SDL_GPU_FILTER_NEAREST;
+        sampler_info.mag_filter = SDL_GPU_FILTER_NEAREST;
+        sampler_info.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST;
+        sampler_info.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        sampler_info.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        sampler_info.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        overlay_depth_sampler = SDL_CreateGPUSampler(device, &sampler_info);
+        sampler_info.min_filter = SDL_GPU_FILTER_LINEAR;
+        sampler_info.mag_filter = SDL_GPU_FILTER_LINEAR;
+        overlay_sampler = SDL_CreateGPUSampler(device, &sampler_info);
+        if (!overlay_depth_sampler || !overlay_sampler) {
+            goto error;
+        }
+    }
+    if (budget) {
+        pool_capacity = SDL_max(1, budget / BUFFER_CAPACITY);
+        pool = Malloc(pool_capacity * (POOL_FENCES + 1) * sizeof(Uint32));
+        if (!pool) {
+            goto error;
+        }
+        for (int i = 0; i < POOL_FENCES; i++) {
+            pool_fences[i].slots = pool + pool_capacity * (i + 1);
+        }
+        SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+        transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transfer_buffer_info.size = pool_capacity * BUFFER_CAPACITY;
+        pool_transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+        SDL_GPUBufferCreateInfo buffer_info = {0};
+        buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+        buffer_info.size = pool_capacity * BUFFER_CAPACITY;
+        pool_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+        if (!pool_transfer_buffer || !pool_buffer) {
+            goto error;
+        }
+        for (pool_size = 0; pool_size < pool_capacity; pool_size++) {
+            pool[pool_size] = pool_size;
+        }
+    }
+    if (threaded) {
+        pack_quit = false;
+        pack_start = SDL_CreateSemaphore(0);
+        pack_done = SDL_CreateSemaphore(0);
+        if (!pack_start || !pack_done) {
+            goto error;
+        }
+        pack_thread = SDL_CreateThread(PackFrames, "SDL_GPUD", NULL);
+        if (!pack_thread) {
+            goto error;
+        }
+    }
+    if (append_capacity) {
+        SDL_GPUBufferCreateInfo buffer_info = {0};
+        buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ |
+            SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE;
+        buffer_info.size = append_capacity * sizeof(SDL_GPUDVertex);
+        append_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+        buffer_info.usage = SDL_GPU_BUFFERUSAGE_INDIRECT | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ |
+            SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE;
+        buffer_info.size = sizeof(SDL_GPUIndirectDrawCommand);
+        append_counter = SDL_CreateGPUBuffer(device, &buffer_info);
+        SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+        transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transfer_buffer_info.size = sizeof(SDL_GPUIndirectDrawCommand);
+        append_reset = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+        if (!append_buffer || !append_counter || !append_reset) {
+            goto error;
+        }
+        SDL_GPUIndirectDrawCommand* args = SDL_MapGPUTransferBuffer(device, append_reset, false);
+        if (!args) {
+            goto error;
+        }
+        SDL_zerop(args);
+        args->num_instances = 1;
+        SDL_UnmapGPUTransferBuffer(device, append_reset);
+        SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(device);
+        if (!command_buffer) {
+            goto error;
+        }
+        ResetAppendBuffer(command_buffer);
+        if (!SDL_SubmitGPUCommandBuffer(command_buffer)) {
+            goto error;
+        }
+    }
+    dropped_bytes = 0;
+    grown_bytes = 0;
+    bool status = true;
+    goto success;
+error:
+    status = false;
+success:
+    if (!status) {
+        SDL_QuitGPUD();
+    }
+    return status;
+}
+
+static void ResetDuplicates()
+{
+    last_hash_set.primitives = hash_set.primitives;
+    last_hash_set.duplicates = hash_set.duplicates;
+    last_hash_set.bytes = hash_set.bytes;
+    hash_set.primitives = 0;
+    hash_set.duplicates = 0;
+    hash_set.bytes = 0;
+    if (hash_set.size) {
+        SDL_memset(hash_set.entries, 0, hash_set.capacity * sizeof(HashEntry));
+        hash_set.size = 0;
+    }
+    hash_set.data_size = 0;
+}
+
+static void ReleaseCommand(
+    Command* command)
+{
+    /* Uploaded slots are only written again once the GPU is done with them */
+    if (command->pooled && command->buffer && pool_fence) {
+        pool_fence->slots[pool_fence->num_slots++] = command->offset / BUFFER_CAPACITY;
+        return;
+    } else if (command->pooled) {
+        pool[pool_size++] = command->offset / BUFFER_CAPACITY;
+        return;
+    }
+    if (command->transfer_buffer) {
+        SDL_ReleaseGPUTransferBuffer(device, command->transfer_buffer);
+    }
+    if (command->buffer) {
+        SDL_ReleaseGPUBuffer(device, command->buffer);
+    }
+}
+
+/* Returns the slots of every upload the GPU has finished to the pool */
+static void ReclaimPool()
+{
+    for (int i = 0; i < POOL_FENCES; i++) {
+        PoolFence* entry = &pool_fences[i];
+        if (!entry->fence || !SDL_QueryGPUFence(device, entry->fence)) {
+            continue;
+        }
+        SDL_memcpy(pool + pool_size, entry->slots, entry->num_slots * sizeof(Uint32));
+        pool_size += entry->num_slots;
+        SDL_ReleaseGPUFence(device, entry->fence);
+        entry->fence = NULL;
+        entry->num_slots = 0;
+    }
+}
+
+/* Unmaps the transfer buffers of the batches before they are uploaded */
+static void UnmapCommands()
+{
+    for (Command* command = head; command; command = command->next) {
+        if (!command->pooled) {
+            SDL_UnmapGPUTransferBuffer(device, command->transfer_buffer);
+        }
+        command->data = NULL;
+    }
+    if (pool_data) {
+        SDL_UnmapGPUTransferBuffer(device, pool_transfer_buffer);
+        pool_data = NULL;
+    }
+}
+
+static void FreeCachedFrame(
+    CachedFrame* cached_frame)
+{
+    for (Command* command = cached_frame->head; command; command = command->next) {
+        ReleaseCommand(command);
+    }
+    Free(cached_frame->head);
+    cached_frame->head = NULL;
+    cached_frame->transforms = NULL;
+    cached_frame->num_transforms = 0;
+}
+
+static void ResetFrame()
+{
+    arena_block = NULL;
+    arena_used = 0;
+    head = NULL;
+    tail = NULL;
+    num_transforms = 1;
+    transform_depth = 0;
+    transform = 0;
+    frame_hash = 0;
+    frame_size = 0;
+    num_cloud_draws = 0;
+    num_shape_arcs = 0;
+    SDL_zeroa(shape_vertices);
+    ResetDuplicates();
+    if (restore_pending) {
+        SDL_memcpy(custom_matrix, restore_custom, sizeof(custom_matrix));
+        viewport_width = restore_viewport[0];
+        viewport_height = restore_viewport[1];
+        restore_pending = false;
+    }
+}
+
+static void ReleaseCommands()
+{
+    for (Command* command = head; command; command = command->next) {
+        ReleaseCommand(command);
+        if (threaded) {
+            Free(command->data);
+        }
+    }
+    pool_fence = NULL;
+    ResetFrame();
+}
+
+void SDL_QuitGPUD()
+{
+    if (!device) {
+        return;
+    }
+    SDL_EndGPUDCapture();
+    SDL_EndGPUDStream();
+    if (sealed.pending) {
+        SDL_WaitSemaphore(pack_done);
+        sealed.pending = false;
+    }
+    if (pack_thread) {
+        pack_quit = true;
+        SDL_SignalSemaphore(pack_start);
+        SDL_WaitThread(pack_thread, NULL);
+        pack_thread = NULL;
+    }
+    SDL_DestroySemaphore(pack_start);
+    SDL_DestroySemaphore(pack_done);
+    pack_start = NULL;
+    pack_done = NULL;
+    for (Command* command = sealed.head; command; command = command->next) {
+        ReleaseCommand(command);
+    }
+    Free(sealed.transforms);
+    Free(sealed.cloud_draws);
+    while (sealed.arena) {
+        CommandBlock* block = sealed.arena;
+        sealed.arena = block->next;
+        Free(block);
+    }
+    SDL_zero(sealed);
+    Free(stream_receive.words);
+    Free(stream_decode.words);
+    SDL_zero(stream_receive);
+    SDL_zero(stream_decode);
+    Free(hash_set.entries);
+    Free(hash_set.data);
+    SDL_zero(hash_set);
+    for (int i = 0; i < CACHED_FRAMES; i++) {
+        FreeCachedFrame(&cached_frames[i]);
+        SDL_zero(cached_frames[i]);
+    }
+    Free(translucents);
+    Free(sort_keys);
+    translucents = NULL;
+    sort_keys = NULL;
+    num_translucents = 0;
+    translucent_capacity = 0;
+    sort_capacity = 0;
+    Free(impostor_points);
+    impostor_points = NULL;
+    num_impostor_points = 0;
+    impostor_capacity = 0;
+    Free(labels);
+    Free(label_text);
+    labels = NULL;
+    label_text = NULL;
+    num_labels = 0;
+    label_capacity = 0;
+    label_text_size = 0;
+    label_text_capacity = 0;
+    Free(shapes);
+    shapes = NULL;
+    num_shapes = 0;
+    shape_capacity = 0;
+    Free(shape_arcs);
+    shape_arcs = NULL;
+    num_shape_arcs = 0;
+    shape_arc_capacity = 0;
+    for (int i = 0; i < TEXT_CACHE_ENTRIES; i++) {
+        Free(text_cache[i].text);
+        Free(text_cache[i].points);
+        SDL_zero(text_cache[i]);
+    }
+    text_index = 0;
+    text_hits = 0;
+    text_misses = 0;
+    Free(transforms);
+    transforms = NULL;
+    transform_capacity = 0;
+    Free(cloud_draws);
+    cloud_draws = NULL;
+    cloud_draw_capacity = 0;
+    if (!threaded) {
+        UnmapCommands();
+    }
+    ReleaseCommands();
+    for (int i = 0; i < POOL_FENCES; i++) {
+        SDL_ReleaseGPUFence(device, pool_fences[i].fence);
+        SDL_zero(pool_fences[i]);
+    }
+    SDL_ReleaseGPUTransferBuffer(device, pool_transfer_buffer);
+    SDL_ReleaseGPUBuffer(device, pool_buffer);
+    pool_transfer_buffer = NULL;
+    pool_buffer = NULL;
+    Free(pool);
+    pool = NULL;
+    pool_size = 0;
+    pool_capacity = 0;
+    SDL_ReleaseGPUTexture(device, overlay_texture);
+    SDL_ReleaseGPUTexture(device, overlay_depth_texture);
+    SDL_ReleaseGPUSampler(device, overlay_sampler);
+    SDL_ReleaseGPUSampler(device, overlay_depth_sampler);
+    overlay_texture = NULL;
+    overlay_depth_texture = NULL;
+    overlay_sampler = NULL;
+    overlay_depth_sampler = NULL;
+    overlay_width = 0;
+    overlay_height = 0;
+    SDL_ReleaseGPUBuffer(device, append_buffer);
+    SDL_ReleaseGPUBuffer(device, append_counter);
+    SDL_ReleaseGPUTransferBuffer(device, append_reset);
+    append_buffer = NULL;
+    append_counter = NULL;
+    append_reset = NULL;
+    SDL_ReleaseGPUComputePipeline(device, shape_pipeline);
+    SDL_ReleaseGPUBuffer(device, shape_arc_buffer);
+    SDL_ReleaseGPUBuffer(device, shape_transform_buffer);
+    SDL_ReleaseGPUBuffer(device, shape_vertex_buffer);
+    SDL_ReleaseGPUBuffer(device, shape_draw_buffer);
+    SDL_ReleaseGPUTransferBuffer(device, shape_transfer_buffer);
+    shape_pipeline = NULL;
+    shape_arc_buffer = NULL;
+    shape_transform_buffer = NULL;
+    shape_vertex_buffer = NULL;
+    shape_draw_buffer = NULL;
+    shape_transfer_buffer = NULL;
+    shape_arc_size = 0;
+    shape_transform_size = 0;
+    shape_vertex_size = 0;
+    shape_transfer_size = 0;
+    while (arena_head) {
+        CommandBlock* block = arena_head;
+        arena_head = block->next;
+        Free(block);
+    }
+    SDL_ReleaseGPUGraphicsPipeline(device, line_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, line_3d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, poly_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, poly_3d_pipeline);
+    line_2d_pipeline = NULL;
+    line_3d_pipeline = NULL;
+    poly_2d_pipeline = NULL;
+    poly_3d_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, translucent_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, translucent_3d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, resolve_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, resolve_3d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, composite_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, overlay_depth_pipeline);
+    SDL_ReleaseGPUTexture(device, accum_texture);
+    SDL_ReleaseGPUTexture(device, reveal_texture);
+    SDL_ReleaseGPUSampler(device, blend_sampler);
+    translucent_2d_pipeline = NULL;
+    translucent_3d_pipeline = NULL;
+    resolve_2d_pipeline = NULL;
+    resolve_3d_pipeline = NULL;
+    composite_pipeline = NULL;
+    overlay_depth_pipeline = NULL;
+    accum_texture = NULL;
+    reveal_texture = NULL;
+    blend_sampler = NULL;
+    blend_width = 0;
+    blend_height = 0;
+    SDL_ReleaseGPUGraphicsPipeline(device, overlay_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, overlay_3d_pipeline);
+    overlay_2d_pipeline = NULL;
+    overlay_3d_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, label_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, label_occluded_pipeline);
+    label_pipeline = NULL;
+    label_occluded_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, glyph_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, glyph_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, glyph_occluded_pipeline);
+    SDL_ReleaseGPUBuffer(device, glyph_buffer);
+    glyph_2d_pipeline = NULL;
+    glyph_pipeline = NULL;
+    glyph_occluded_pipeline = NULL;
+    glyph_buffer = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, poly_screen_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, overlay_screen_pipeline);
+    poly_screen_pipeline = NULL;
+    overlay_screen_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, point_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, point_3d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, point_screen_pipeline);
+    point_2d_pipeline = NULL;
+    point_3d_pipeline = NULL;
+    point_screen_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, graph_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, graph_3d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, graph_screen_pipeline);
+    graph_2d_pipeline = NULL;
+    graph_3d_pipeline = NULL;
+    graph_screen_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, trail_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, trail_3d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, trail_screen_pipeline);
+    trail_2d_pipeline = NULL;
+    trail_3d_pipeline = NULL;
+    trail_screen_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, sphere_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, sphere_3d_pipeline);
+    sphere_2d_pipeline = NULL;
+    sphere_3d_pipeline = NULL;
+    SDL_ReleaseGPUGraphicsPipeline(device, grid_2d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, grid_3d_pipeline);
+    SDL_ReleaseGPUGraphicsPipeline(device, grid_screen_pipeline);
+    grid_2d_pipeline = NULL;
+    grid_3d_pipeline = NULL;
+    grid_screen_pipeline = NULL;
+    for (int i = 0; i < num_wireframe_pipelines; i++) {
+        for (int j = 0; j < 3; j++) {
+            SDL_ReleaseGPUGraphicsPipeline(device, wireframe_pipelines[i].pipelines[j]);
+        }
+        SDL_zero(wireframe_pipelines[i]);
+    }
+    num_wireframe_pipelines = 0;
+    SDL_ReleaseGPUShader(device, fragment_shader);
+    SDL_ReleaseGPUShader(device, vertex_shader);
+    SDL_ReleaseGPUShader(device, point_vertex_shader);
+    SDL_ReleaseGPUShader(device, trail_vertex_shader);
+    SDL_ReleaseGPUShader(device, graph_vertex_shader);
+    SDL_ReleaseGPUShader(device, label_vertex_shader);
+    SDL_ReleaseGPUShader(device, sphere_vertex_shader);
+    SDL_ReleaseGPUShader(device, sphere_fragment_shader);
+    SDL_ReleaseGPUShader(device, grid_vertex_shader);
+    SDL_ReleaseGPUShader(device, grid_fragment_shader);
+    SDL_ReleaseGPUShader(device, fullscreen_vertex_shader);
+    SDL_ReleaseGPUShader(device, translucent_fragment_shader);
+    SDL_ReleaseGPUShader(device, resolve_fragment_shader);
+    SDL_ReleaseGPUShader(device, composite_fragment_shader);
+    SDL_ReleaseGPUShader(device, depth_fragment_shader);
+    fragment_shader = NULL;
+    vertex_shader = NULL;
+    point_vertex_shader = NULL;
+    trail_vertex_shader = NULL;
+    graph_vertex_shader = NULL;
+    label_vertex_shader = NULL;
+    sphere_vertex_shader = NULL;
+    sphere_fragment_shader = NULL;
+    grid_vertex_shader = NULL;
+    grid_fragment_shader = NULL;
+    fullscreen_vertex_shader = NULL;
+    translucent_fragment_shader = NULL;
+    resolve_fragment_shader = NULL;
+    composite_fragment_shader = NULL;
+    depth_fragment_shader = NULL;
+    SDL_ReleaseGPUBuffer(device, cloud_colors);
+    SDL_ReleaseGPUTransferBuffer(device, cloud_color_transfer);
+    cloud_colors = NULL;
+    cloud_color_transfer = NULL;
+    cloud_color_capacity = 0;
+    device = NULL;
+}
+
+void SDL_SetGPUDColor(
+    const SDL_FColor* handle)
+{
+    if (!device) {
+        return;
+    }
+    if (!handle) {
+        SDL_InvalidParamError("handle");
+        return;
+    }
+    const Uint8 red = SDL_min(handle->r * UINT8_MAX, UINT8_MAX);
+    const Uint8 green = SDL_min(handle->g * UINT8_MAX, UINT8_MAX);
+    const Uint8 blue = SDL_min(handle->b * UINT8_MAX, UINT8_MAX);
+    const Uint8 alpha = SDL_min(handle->a * UINT8_MAX, UINT8_MAX);
+    color = red << 24 | green << 16 | blue << 8 | alpha;
+}
+
+static Uint64 HashPrimitive(
+    const CommandType type,
+    const void* data,
+    const Uint32 size)
+{
+    /* Primitives are whole lines or triangles of 16 byte vertices or whole
+     * lines of 12 byte overlay vertices, so the data is always whole 64-bit
+     * words */
+    const Uint8* bytes = data;
+    Uint64 hash = (Uint64) slot << 56 ^ (Uint64) transform << 40 ^ (Uint64) type << 32 ^ size;
+    for (Uint32 i = 0; i < size; i += sizeof(Uint64)) {
+        Uint64 word;
+        SDL_memcpy(&word, bytes + i, sizeof(word));
+        hash ^= word;
+        hash *= 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 29;
+    }
+    return hash ? hash : 1;
+}
+
+/* Returns false if the primitive was already recorded since the last submit */
+static bool InsertPrimitive(
+    const CommandType type,
+    const void* data,
+    const Uint32 size)
+{
+    hash_set.primitives++;
+    if (hash_set.size * 2 >= hash_set.capacity) {
+        const Uint32 capacity = SDL_max(1024, hash_set.capacity * 2);
+        HashEntry* entries = Calloc(capacity, sizeof(HashEntry));
+        if (!entries) {
+            return true;
+        }
+        for (Uint32 i = 0; i < hash_set.capacity; i++) {
+            if (!hash_set.entries[i].hash) {
+                continue;
+            }
+            Uint32 j = hash_set.entries[i].hash & (capacity - 1);
+            while (entries[j].hash) {
+                j = (j + 1) & (capacity - 1);
+            }
+            entries[j] = hash_set.entries[i];
+        }
+        Free(hash_set.entries);
+        hash_set.entries = entries;
+        hash_set.capacity = capacity;
+    }
+    const Uint64 hash = HashPrimitive(type, data, size);
+    Uint32 i = hash & (hash_set.capacity - 1);
+    while (hash_set.entries[i].hash) {
+        const HashEntry* entry = &hash_set.entries[i];
+        if (entry->hash == hash && entry->size == size && entry->type == type &&
+            entry->transform == transform && entry->slot == slot &&
+            !SDL_memcmp(hash_set.data + entry->offset, data, size)) {
+            hash_set.duplicates++;
+            hash_set.bytes += size;
+            return false;
+        }
+        i = (i + 1) & (hash_set.capacity - 1);
+    }
+    if (hash_set.data_size + size > hash_set.data_capacity) {
+        const Uint32 capacity = SDL_max(hash_set.data_size + size, SDL_max(65536, hash_set.data_capacity * 2));
+        Uint8* bytes = Realloc(hash_set.data, capacity);
+        if (!bytes) {
+            return true;
+        }
+        hash_set.data = bytes;
+        hash_set.data_capacity = capacity;
+    }
+    SDL_memcpy(hash_set.data + hash_set.data_size, data, size);
+    HashEntry* entry = &hash_set.entries[i];
+    entry->hash = hash;
+    entry->offset = hash_set.data_size;
+    entry->size = size;
+    entry->type = type;
+    entry->transform = transform;
+    entry->slot = slot;
+    hash_set.data_size += size;
+    hash_set.size++;
+    return true;
+}
+
+/* Primitives are only ever split between whole lines or triangles */
+static Uint32 GetPrimitiveSize(
+    const CommandType type)
+{
+    switch (type) {
+    case COMMAND_TYPE_POLY:
+    case COMMAND_TYPE_TRANSLUCENT:
+        return 3 * sizeof(SDL_GPUDVertex);
+    case COMMAND_TYPE_OVERLAY:
+        return 2 * sizeof(OverlayVertex);
+    case COMMAND_TYPE_SPHERE:
+        /* The center and color, then the radius in x */
+        return 2 * sizeof(SDL_GPUDVertex);
+    case COMMAND_TYPE_GLYPH:
+    case COMMAND_TYPE_GLYPH_OCCLUDED:
+        /* The anchor and color, then the pen, size and glyph */
+        return 2 * sizeof(SDL_GPUDVertex);
+    default:
+        return 2 * sizeof(SDL_GPUDVertex);
+    }
+}
+
+/* Returns the newest batch of the lowest priority below the current one to
+ * the pool */
+static bool EvictCommand()
+{
+    Command* evicted = NULL;
+    Command* evicted_prev = NULL;
+    Command* prev = NULL;
+    for (Command* command = head; command; prev = command, command = command->next) {
+        if (command->pooled && command->priority < priority &&
+            (!evicted || command->priority <= evicted->priority)) {
+            evicted = command;
+            evicted_prev = prev;
+        }
+    }
+    if (!evicted) {
+        return false;
+    }
+    if (evicted_prev) {
+        evicted_prev->next = evicted->next;
+    } else {
+        head = evicted->next;
+    }
+    if (tail == evicted) {
+        tail = evicted_prev;
+    }
+    pool[pool_size++] = evicted->offset / BUFFER_CAPACITY;
+    dropped_bytes += evicted->size;
+    return true;
+}
+
+/* Makes sure the pool can hold the primitive, evicting if allowed */
+static bool ReserveCommands(
+    const CommandType type,
+    const Uint32 size)
+{
+    const Uint32 unit = GetPrimitiveSize(type);
+    Uint32 available = 0;
+    if (tail && tail->type == type && tail->priority == priority && tail->transform == transform &&
+        tail->slot == slot) {
+        available = (tail->capacity - tail->size) / unit * unit;
+    }
+    if (size <= available) {
+        return true;
+    }
+    const Uint32 batch = BUFFER_CAPACITY / unit * unit;
+    const int needed = (size - available + batch - 1) / batch;
+    if (pool_size < needed) {
+        ReclaimPool();
+    }
+    while (pool_size < needed) {
+        if (overflow != SDL_GPUD_OVERFLOW_DROP_LOWEST_PRIORITY || !EvictCommand()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static Command* CreateCommand(
+    const CommandType type,
+    const Uint32 capacity)
+{
+    Command* command = AllocateCommand();
+    if (!command) {
+        return NULL;
+    }
+    command->next = NULL;
+    command->type = type;
+    command->size = 0;
+    command->capacity = capacity;
+    command->data = NULL;
+    command->buffer = NULL;
+    command->priority = priority;
+    command->transform = transform;
+    command->slot = slot;
+    command->offset = 0;
+    if (budget && !pool_size) {
+        ReclaimPool();
+    }
+    command->pooled = budget && pool_size;
+    if (threaded) {
+        command->transfer_buffer = NULL;
+        command->data = Malloc(capacity);
+        if (!command->data) {
+            return NULL;
+        }
+    } else if (command->pooled) {
+        /* Slots in flight are never handed out, so nothing mapped here is
+         * still being uploaded and the buffer is not cycled */
+        if (!pool_data) {
+            pool_data = SDL_MapGPUTransferBuffer(device, pool_transfer_buffer, false);
+            if (!pool_data) {
+                return NULL;
+            }
+        }
+        command->transfer_buffer = pool_transfer_buffer;
+        command->offset = pool[--pool_size] * BUFFER_CAPACITY;
+        command->data = pool_data + command->offset;
+    } else {
+        SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+        transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transfer_buffer_info.size = command->capacity;
+        command->transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+        command->data = SDL_MapGPUTransferBuffer(device, command->transfer_buffer, false);
+        if (!command->data) {
+            SDL_ReleaseGPUTransferBuffer(device, command->transfer_buffer);
+            return NULL;
+        }
+    }
+    if (budget && !command->pooled) {
+        grown_bytes += command->capacity;
+    }
+    if (tail) {
+        tail->next = command;
+    }
+    tail = command;
+    if (!head) {
+        head = command;
+    }
+    return command;
+}
+
+static void PushCommand(
+    const CommandType type,
+    void* data,
+    const Uint32 size)
+{
+    if (deduplicate && !InsertPrimitive(type, data, size)) {
+        return;
+    }
+    if (budget && overflow != SDL_GPUD_OVERFLOW_GROW && !ReserveCommands(type, size)) {
+        dropped_bytes += size;
+        return;
+    }
+    /* The GPU buffer is only created on submit, cached frames never need it.
+     * The copy below is still needed, a hit is only known at submit */
+    const Uint32 unit = budget ? GetPrimitiveSize(type) : size;
+    Uint32 offset = 0;
+    while (offset < size) {
+        Command* command = tail;
+        if (!command || command->type != type || command->priority != priority ||
+            command->transform != transform || command->slot != slot ||
+            command->size + unit > command->capacity) {
+            command = CreateCommand(type, budget ? BUFFER_CAPACITY : SDL_max(BUFFER_CAPACITY, size));
+            if (!command) {
+                dropped_bytes += size - offset;
+                return;
+            }
+        }
+        const Uint32 count = SDL_min(size - offset, (command->capacity - command->size) / unit * unit);
+        SDL_memcpy(command->data + command->size, (Uint8*) data + offset, count);
+        command->size += count;
+        offset += count;
+    }
+    if (frame_cache) {
+        frame_hash = (frame_hash ^ HashPrimitive(type, data, size)) * 0x100000001B3ull;
+        frame_size += size;
+    }
+}
+
+/* Captured, streamed and ring vertices are already in the space of their
+ * slot, so neither the transform nor the priority of the caller applies */
+static void PushBaked(
+    const CommandType type,
+    void* data,
+    const Uint32 size)
+{
+    const int previous_transform = transform;
+    const int previous_priority = priority;
+    transform = 0;
+    priority = 0;
+    PushCommand(type, data, size);
+    transform = previous_transform;
+    priority = previous_priority;
+}
+
+static void DeferPoint(
+    DeferredPoint** points,
+    int* num_points,
+    int* point_capacity,
+    const SDL_GPUDVertex* center,
+    const float radius)
+{
+    if (*num_points == *point_capacity) {
+        const int capacity = SDL_max(256, *point_capacity * 2);
+        DeferredPoint* data = Realloc(*points, capacity * sizeof(DeferredPoint));
+        if (!data) {
+            return;
+        }
+        *points = data;
+        *point_capacity = capacity;
+    }
+    DeferredPoint* point = &(*points)[(*num_points)++];
+    point->center = *center;
+    point->center.color = color;
+    TransformPoint(&point->center, transform);
+    point->radius = radius;
+}
+
+static void PushPoint(
+    const CommandType type,
+    const SDL_GPUDVertex* center,
+    const float radius,
+    const Uint32 color)
+{
+    SDL_GPUDVertex start = {0};
+    SDL_GPUDVertex end = {0};
+    start.x = center->x - radius;
+    start.y = center->y - radius;
+    start.z = center->z - radius;
+    end.x = center->x + radius;
+    end.y = center->y + radius;
+    end.z = center->z + radius;
+    SDL_GPUDVertex vertices[36] = {
+        {start.x, start.y, end.z, color},
+        {end.x, start.y, end.z, color},
+        {end.x, end.y, end.z, color},
+        {start.x, start.y, end.z, color},
+        {end.x, end.y, end.z, color},
+        {start.x, end.y, end.z, color},
+        {start.x, start.y, start.z, color},
+        {start.x, end.y, start.z, color},
+        {end.x, end.y, start.z, color},
+        {start.x, start.y, start.z, color},
+        {end.x, end.y, start.z, color},
+        {end.x, start.y, start.z, color},
+        {start.x, start.y, start.z, color},
+        {start.x, start.y, end.z, color},
+        {start.x, end.y, end.z, color},
+        {start.x, start.y, start.z, color},
+        {start.x, end.y, end.z, color},
+        {start.x, end.y, start.z, color},
+        {end.x, start.y, start.z, color},
+        {end.x, end.y, start.z, color},
+        {end.x, end.y, end.z, color},
+        {end.x, start.y, start.z, color},
+        {end.x, end.y, end.z, color},
+        {end.x, start.y, end.z, color},
+        {start.x, end.y, start.z, color},
+        {start.x, end.y, end.z, color},
+        {end.x, end.y, end.z, color},
+        {start.x, end.y, start.z, color},
+        {end.x, end.y, end.z, color},
+        {end.x, end.y, start.z, color},
+        {start.x, start.y, start.z, color},
+        {end.x, start.y, start.z, color},
+        {end.x, start.y, end.z, color},
+        {start.x, start.y, start.z, color},
+        {end.x, start.y, end.z, color},
+        {start.x, start.y, end.z, color},
+    };
+    PushCommand(type, vertices, sizeof(vertices));
+}
+
+void SDL_SetGPUDImpostors(
+    const bool enabled)
+{
+    impostors = enabled;
+}
+
+void SDL_DrawGPUDPoint(
+    const SDL_GPUDVertex* center,
+    const float radius)
+{
+    if (!device) {
+        return;
+    }
+    if (!center) {
+        SDL_InvalidParamError("center");
+        return;
+    }
+    if (radius < SDL_FLT_EPSILON) {
+        SDL_InvalidParamError("radius");
+        return;
+    }
+    /* Only world points are sorted or drawn as spheres, other slots draw now */
+    if (slot != SDL_GPUD_SLOT_WORLD) {
+        PushPoint(COMMAND_TYPE_POLY, center, radius, color);
+        return;
+    }
+    if (translucency != SDL_GPUD_TRANSLUCENCY_NONE && (color & 0xFF) < 0xFF) {
+        DeferPoint(&translucents, &num_translucents, &translucent_capacity, center, radius);
+        return;
+    }
+    if (impostors) {
+        DeferPoint(&impostor_points, &num_impostor_points, &impostor_capacity, center, radius);
+        return;
+    }
+    PushPoint(COMMAND_TYPE_POLY, center, radius, color);
+}
+
+void SDL_DrawGPUDBox(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end)
+{
+    if (!device) {
+        return;
+    }
+    if (!start) {
+        SDL_InvalidParamError("start");
+        return;
+    }
+    if (!end) {
+        SDL_InvalidParamError("end");
+        return;
+    }
+    SDL_GPUDVertex vertices[24] = {
+        {start->x, start->y, start->z, color},
+        {end->x, start->y, start->z, color},
+        {end->x, start->y, start->z, color},
+        {end->x, start->y, end->z, color},
+        {end->x, start->y, end->z, color},
+        {start->x, start->y, end->z, color},
+        {start->x, start->y, end->z, color},
+        {start->x, start->y, start->z, color},
+        {start->x, end->y, start->z, color},
+        {end->x, end->y, start->z, color},
+        {end->x, end->y, start->z, color},
+        {end->x, end->y, end->z, color},
+        {end->x, end->y, end->z, color},
+        {start->x, end->y, end->z, color},
+        {start->x, end->y, end->z, color},
+        {start->x, end->y, start->z, color},
+        {start->x, start->y, start->z, color},
+        {start->x, end->y, start->z, color},
+        {end->x, start->y, start->z, color},
+        {end->x, end->y, start->z, color},
+        {end->x, start->y, end->z, color},
+        {end->x, end->y, end->z, color},
+        {start->x, start->y, end->z, color},
+        {start->x, end->y, end->z, color},
+    };
+    PushCommand(COMMAND_TYPE_LINE, vertices, sizeof(vertices));
+}
+
+void SDL_DrawGPUDLine(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end)
+{
+    if (!device) {
+        return;
+    }
+    if (!start) {
+        SDL_InvalidParamError("start");
+        return;
+    }
+    if (!end) {
+        SDL_InvalidParamError("end");
+        return;
+    }
+    SDL_GPUDVertex vertices[2];
+    vertices[0] = *start;
+    vertices[1] = *end;
+    vertices[0].color = color;
+    vertices[1].color = color;
+    PushCommand(COMMAND_TYPE_LINE, vertices, sizeof(vertices));
+}
+
+void SDL_DrawGPUDLine2D(
+    const SDL_FPoint* start,
+    const SDL_FPoint* end)
+{
+    if (!device) {
+        return;
+    }
+    if (!start) {
+        SDL_InvalidParamError("start");
+        return;
+    }
+    if (!end) {
+        SDL_InvalidParamError("end");
+        return;
+    }
+    OverlayVertex vertices[2] = {
+        {start->x, start->y, color},
+        {end->x, end->y, color},
+    };
+    PushCommand(COMMAND_TYPE_OVERLAY, vertices, sizeof(vertices));
+}
+
+void SDL_DrawGPUDSphere(
+    const SDL_GPUDVertex* center,
+    const float radius)
+{
+    if (!device) {
+        return;
+    }
+    if (!center) {
+        SDL_InvalidParamError("center");
+        return;
+    }
+    if (radius < SDL_FLT_EPSILON) {
+        SDL_InvalidParamError("radius");
+        return;
+    }
+    SDL_GPUDVertex vertices[SPHERE_VERTICES * SPHERE_VERTICES * 2];
+    int index = 0;
+    for (int i = 0; i < SPHERE_VERTICES; i++) {
+        const float phi = i / (float) (SPHERE_VERTICES - 1) * SDL_PI_F;
+        for (int j = 0; j < SPHERE_VERTICES; j++) {
+            const float theta = j / (float) (SPHERE_VERTICES - 1) * 2 * SDL_PI_F;
+            vertices[index].x = center->x + radius * SDL_sin(phi) * SDL_cos(theta);
+            vertices[index].y = center->y + radius * SDL_sin(phi) * SDL_sin(theta);
+            vertices[index].z = center->z + radius * SDL_cos(phi);
+            vertices[index].color = center->color;
+            index++;
+        }
+    }
+    for (int i = 0; i < SPHERE_VERTICES - 1; i++) {
+        for (int j = 0; j < SPHERE_VERTICES; j++) {
+            const int curr = i * SPHERE_VERTICES + j;
+            const int next = ((i + 1) * SPHERE_VERTICES + j) % (SPHERE_VERTICES * SPHERE_VERTICES);
+            SDL_DrawGPUDLine(&vertices[curr], &vertices[next]);
+        }
+    }
+    for (int i = 0; i < SPHERE_VERTICES - 1; i++) {
+        for (int j = 0; j < SPHERE_VERTICES - 1; j++) {
+            const int curr = i * SPHERE_VERTICES + j;
+            const int next = i * SPHERE_VERTICES + (j + 1);
+            SDL_DrawGPUDLine(&vertices[curr], &vertices[next]);
+        }
+    }
+}
+
+static Shape* PushShape(
+    const ShapeType type)
+{
+    if (num_shapes == shape_capacity) {
+        const int capacity = SDL_max(64, shape_capacity * 2);
+        Shape* data = Realloc(shapes, capacity * sizeof(Shape));
+        if (!data) {
+            return NULL;
+        }
+        shapes = data;
+        shape_capacity = capacity;
+    }
+    Shape* shape = &shapes[num_shapes++];
+    shape->type = type;
+    shape->color = color;
+    shape->transform = transform;
+    shape->slot = slot;
+    return shape;
+}
+
+static void PushSegment(
+    const ShapeType type,
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end,
+    const float radius)
+{
+    Shape* shape = PushShape(type);
+    if (!shape) {
+        return;
+    }
+    shape->params[0] = start->x;
+    shape->params[1] = start->y;
+    shape->params[2] = start->z;
+    shape->params[3] = end->x;
+    shape->params[4] = end->y;
+    shape->params[5] = end->z;
+    shape->params[6] = radius;
+}
+
+void SDL_DrawGPUDArc(
+    const SDL_GPUDVertex* center,
+    const SDL_GPUDVertex* normal,
+    const float radius,
+    const float start,
+    const float end)
+{
+    if (!device) {
+        return;
+    }
+    if (!center) {
+        SDL_InvalidParamError("center");
+        return;
+    }
+    if (!normal) {
+        SDL_InvalidParamError("normal");
+        return;
+    }
+    if (radius < SDL_FLT_EPSILON) {
+        SDL_InvalidParamError("radius");
+        return;
+    }
+    Shape* shape = PushShape(SHAPE_TYPE_ARC);
+    if (!shape) {
+        return;
+    }
+    shape->params[0] = center->x;
+    shape->params[1] = center->y;
+    shape->params[2] = center->z;
+    shape->params[3] = normal->x;
+    shape->params[4] = normal->y;
+    shape->params[5] = normal->z;
+    shape->params[6] = radius;
+    shape->params[7] = start;
+    shape->params[8] = end;
+}
+
+void SDL_DrawGPUDCircle(
+    const SDL_GPUDVertex* center,
+    const SDL_GPUDVertex* normal,
+    const float radius)
+{
+    SDL_DrawGPUDArc(center, normal, radius, 0.0f, 2.0f * SDL_PI_F);
+}
+
+void SDL_DrawGPUDCylinder(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end,
+    const float radius)
+{
+    if (!device) {
+        return;
+    }
+    if (!start) {
+        SDL_InvalidParamError("start");
+        return;
+    }
+    if (!end) {
+        SDL_InvalidParamError("end");
+        return;
+    }
+    if (radius < SDL_FLT_EPSILON) {
+        SDL_InvalidParamError("radius");
+        return;
+    }
+    PushSegment(SHAPE_TYPE_CYLINDER, start, end, radius);
+}
+
+void SDL_DrawGPUDCapsule(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end,
+    const float radius)
+{
+    if (!device) {
+        return;
+    }
+    if (!start) {
+        SDL_InvalidParamError("start");
+        return;
+    }
+    if (!end) {
+        SDL_InvalidParamError("end");
+        return;
+    }
+    if (radius < SDL_FLT_EPSILON) {
+        SDL_InvalidParamError("radius");
+        return;
+    }
+    PushSegment(SHAPE_TYPE_CAPSULE, start, end, radius);
+}
+
+void SDL_DrawGPUDCone(
+    const SDL_GPUDVertex* apex,
+    const SDL_GPUDVertex* base,
+    const float radius)
+{
+    if (!device) {
+        return;
+    }
+    if (!apex) {
+        SDL_InvalidParamError("apex");
+        return;
+    }
+    if (!base) {
+        SDL_InvalidParamError("base");
+        return;
+    }
+    if (radius < SDL_FLT_EPSILON) {
+        SDL_InvalidParamError("radius");
+        return;
+    }
+    PushSegment(SHAPE_TYPE_CONE, apex, base, radius);
+}
+
+void SDL_DrawGPUDArrow(
+    const SDL_GPUDVertex* start,
+    const SDL_GPUDVertex* end,
+    const float size)
+{
+    if (!device) {
+        return;
+    }
+    if (!start) {
+        SDL_InvalidParamError("start");
+        return;
+    }
+    if (!end) {
+        SDL_InvalidParamError("end");
+        return;
+    }
+    if (size < SDL_FLT_EPSILON) {
+        SDL_InvalidParamError("size");
+        return;
+    }
+    PushSegment(SHAPE_TYPE_ARROW, start, end, size);
+}
+
+void SDL_DrawGPUDFrustum(
+    const void* matrix)
+{
+    if (!device) {
+        return;
+    }
+    if (!matrix) {
+        SDL_InvalidParamError("matrix");
+        return;
+    }
+    Shape* shape = PushShape(SHAPE_TYPE_FRUSTUM);
+    if (!shape) {
+        return;
+    }
+    SDL_memcpy(shape->params, matrix, sizeof(shape->params));
+}
+
+void SDL_SetGPUDShapeDetail(
+    const int segments)
+{
+    shape_detail = SDL_clamp(segments, SHAPE_MIN_DETAIL, SHAPE_MAX_DETAIL);
+}
+
+/* Column and row of a point of DecodeText at GLYPH_SIZE, as in label.vert */
+static Uint32 GetGlyphCode(
+    const int x,
+    const int y)
+{
+    static const int columns[5] = {0, 3, 7, 12, 15};
+    static const int rows[5] = {0, 4, 7, 11, 15};
+    Uint32 code = 0;
+    for (Uint32 i = 0; i < 5; i++) {
+        code |= x == columns[i] ? i : 0;
+        code |= y == rows[i] ? i << 4 : 0;
+    }
+    return code;
+}
+
+static void TextFunc(
+    const int x1,
+    const int y1,
+    const int x2,
+    const int y2)
+{
+    if (glyph_strokes) {
+        if (num_glyph_strokes < GLYPH_MAX_STROKES) {
+            glyph_strokes[num_glyph_strokes++] = GetGlyphCode(x1, y1) | GetGlyphCode(x2, y2) << 8;
+        }
+        return;
+    }
+    if (text_label) {
+        const float scale_x = 2.0f / viewport_width;
+        const float scale_y = 2.0f / viewport_height;
+        SDL_GPUDVertex vertices[2] = {
+            {text_origin[0] + x1 * scale_x, text_origin[1] - y1 * scale_y, text_origin[2], text_label->anchor.color},
+            {text_origin[0] + x2 * scale_x, text_origin[1] - y2 * scale_y, text_origin[2], text_label->anchor.color},
+        };
+        if (text_label->occlude) {
+            PushCommand(COMMAND_TYPE_LABEL_OCCLUDED, vertices, sizeof(vertices));
+        } else {
+            PushCommand(COMMAND_TYPE_LABEL, vertices, sizeof(vertices));
+        }
+        return;
+    }
+    if (text_entry) {
+        if (text_entry->num_points + 2 > text_entry->capacity) {
+            const int capacity = SDL_max(64, text_entry->capacity * 2);
+            SDL_FPoint* data = Realloc(text_entry->points, capacity * sizeof(SDL_FPoint));
+            if (!data) {
+                text_failed = true;
+                return;
+            }
+            text_entry->points = data;
+            text_entry->capacity = capacity;
+        }
+        SDL_FPoint* points = &text_entry->points[text_entry->num_points];
+        points[0].x = x1;
+        points[0].y = y1;
+        points[1].x = x2;
+        points[1].y = y2;
+        text_entry->num_points += 2;
+        return;
+    }
+    SDL_FPoint start = {x1, y1};
+    SDL_FPoint end = {x2, y2};
+    SDL_DrawGPUDLine2D(&start, &end);
+}
+
+/* Modified from: https://github.com/gamelly/gly-type */
+static void DecodeText(
+    const char* text,
+    const int length,
+    const int x,
+    const int y,
+    const int size)
+{
+    static const unsigned char segments_1[] = {
+        0x00, 0x28, 0x81, 0x13, 0xbb, 0x42, 0x33, 0x80, 0x12, 0x21, 0x00, 0x09,
+        0x20, 0x00, 0x80, 0x00, 0x7e, 0x30, 0x76, 0x3e, 0x8c, 0xb9, 0xf9, 0x0f,
+        0xff, 0xbf, 0xc0, 0x60, 0x00, 0x03, 0x00, 0x00, 0xf7, 0xcf, 0xf9, 0xf3,
+        0xe1, 0xf3, 0xc3, 0xfb, 0xcc, 0x33, 0x7c, 0xc0, 0xf0, 0xcf, 0xcc, 0xff,
+        0xc7, 0x8f, 0xc7, 0xbb, 0x03, 0xfc, 0x84, 0xfc, 0x00, 0x84, 0x33, 0xe1,
+        0x00, 0x1e, 0x00, 0x30, 0x00, 0x70, 0xe0, 0xf1, 0x1c, 0xe1, 0xc1, 0xe1,
+        0xc0, 0xc0, 0x60, 0xc0, 0xe0, 0xc9, 0xc1, 0xe1, 0xc1, 0x0e, 0xc0, 0xa1,
+        0x03, 0xe0, 0x04, 0xe4, 0x00, 0x00, 0x16, 0x33, 0x00, 0x33, 0x85
+    };
+    static const unsigned char segments_2[] = {
+        0x00, 0x80, 0x00, 0x80, 0x07, 0x80, 0x4a, 0x00, 0xc8, 0xb0, 0x7b, 0x80,
+        0x80, 0x03, 0x80, 0x50, 0x88, 0x8c, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+        0x03, 0x03, 0x80, 0x80, 0xc8, 0x80, 0x48, 0x9e, 0x06, 0x03, 0x07, 0x00,
+        0xb0, 0x03, 0x03, 0x02, 0x03, 0x04, 0x00, 0x31, 0x00, 0x04, 0x28, 0x00,
+        0x03, 0x03, 0x23, 0x03, 0x04, 0x00, 0xe0, 0x04, 0x78, 0x07, 0x50, 0x00,
+        0x28, 0x00, 0x98, 0x00, 0x08, 0x0d, 0x05, 0x00, 0x06, 0x01, 0x01, 0xa2,
+        0x05, 0x00, 0x04, 0x8d, 0x00, 0x94, 0x04, 0x04, 0x05, 0x06, 0x88, 0xc0,
+        0x04, 0x04, 0xa4, 0xa4, 0x78, 0x58, 0xa0, 0x49, 0x04, 0x32, 0x06
+    };
+    unsigned char c, m1, m2, segment;
+    int sp2, sm1, x1, x2, x3, y1, y2, y3;
+    int sd4, x2m1, x2p1, y2m1, y2p1, sne1;
+    sp2 = size + 2;
+    sm1 = size - 1;
+    sd4 = size / 4;
+    sne1 = ~size & 1;
+    x1 = x;
+    y1 = y;
+    y2 = y1 + (sm1 / 2);
+    y3 = y1 + sm1;
+    if (size < 0) {
+        y3 = y3 ^ y1;
+        y1 = y3 ^ y1;
+        y3 = y3 ^ y1;
+    }
+    const char* end = text + length;
+    while (text < end) {
+        x2 = x1 + (sm1 / 2);
+        x3 = x1 + sm1;
+        c = *text - 0x20;
+        if (c > (0x7f - 0x20)) {
+            goto gly_type_skip_char;
+        }
+        m1 = segments_1[c];
+        m2 = segments_2[c];
+        if (m2 == 0x80) {
+            segment = 0;
+            x2m1 = x2 - sd4;
+            x2p1 = x2 + sd4 + sne1;
+            y2m1 = y2 - sd4 + sne1;
+            y2p1 = y2 + sd4;
+            while (segment < 8) {
+                switch (m1 & (1 << segment) ? segment : 8) {
+                case 0: TextFunc(x1, y2m1, x3, y2m1); break;
+                case 1: TextFunc(x1, y2p1, x3, y2p1); break;
+                case 2: TextFunc(x2, y2, x2, y3); break;
+                case 3: TextFunc(x2, y1, x2, y2p1); break;
+                case 4:
+                    TextFunc(x2m1, y1, x2m1, y3);
+                    TextFunc(x2p1, y1, x2p1, y3);
+                    break;
+                case 5: TextFunc(x2m1, y3, x2p1, y2p1); break;
+                case 6:
+                    TextFunc(x2p1, y2m1, x2p1, y1);
+                    TextFunc(x2m1, y2m1, x2m1, y1);
+                    TextFunc(x2m1, y2m1, x2p1, y2m1);
+                    TextFunc(x2m1, y1, x2p1, y1);
+                    break;
+                case 7:
+                    TextFunc(x2m1, y2p1, x2p1, y2p1);
+                    TextFunc(x2m1, y2p1, x2m1, y3);
+                    TextFunc(x2p1, y2p1, x2p1, y3);
+                    TextFunc(x2m1, y3, x2p1, y3);
+                    break;
+                }
+                segment++;
+            }
+            goto gly_type_next_char;
+        }
+        if ('a' <= *text && *text <= 'z' && !(m1 & 0xe1) && !(m2 & 0x49)) {
+            x3 = x2;
+            x2 = x1;
+        }
+        segment = 0;
+        while (segment < 8) {
+            switch (m1 & (1 << segment) ? segment : 8) {
+            case 0: TextFunc(x1, y1, x2, y1); break;
+            case 1: TextFunc(x2, y1, x3, y1); break;
+            case 2: TextFunc(x3, y1, x3, y2); break;
+            case 3: TextFunc(x3, y2, x3, y3); break;
+            case 4: TextFunc(x2, y3, x3, y3); break;
+            case 5: TextFunc(x1, y3, x2, y3); break;
+            case 6: TextFunc(x1, y2, x1, y3); break;
+            case 7: TextFunc(x1, y1, x1, y2); break;
+            }
+            segment++;
+        }
+        segment = 0;
+        while (segment < 7) {
+            switch (m2 & (1 << segment) ? segment : 7) {
+            case 0: TextFunc(x1, y2, x2, y2); break;
+            case 1: TextFunc(x2, y2, x3, y2); break;
+            case 2:
+                m2 & 0x3 ? TextFunc(x2, y2, x2, m1 & 0x03 ? y1 : y3)
+                         : TextFunc(x2, y1, x2, y3);
+                break;
+            case 3:
+                m2 & 0x80 ? TextFunc(x1, y2, x2, y1)
+                          : TextFunc(x1, y1, x2, y2);
+                break;
+            case 4:
+                m2 & 0x80 ? TextFunc(x2, y1, x3, y2)
+                          : TextFunc(x2, y2, x3, y1);
+                break;
+            case 5:
+                m2 & 0x80 ? TextFunc(x2, y3, x3, y2)
+                          : TextFunc(x2, y2, x3, y3);
+                break;
+            case 6:
+                m2 & 0x80 ? TextFunc(x1, y2, x2, y3)
+                          : TextFunc(x1, y3, x2, y2);
+                break;
+            }
+            segment++;
+        }
+    gly_type_next_char:
+        x1 += sp2;
+    gly_type_skip_char:
+        text++;
+    }
+}
+
+static Uint64 HashText(
+    const char* text,
+    const int length)
+{
+    Uint64 hash = 0xCBF29CE484222325ull;
+    for (int i = 0; i < length; i++) {
+        hash = (hash ^ (Uint8) text[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static TextEntry* FindText(
+    const char* text,
+    const int length,
+    const int size)
+{
+    const Uint64 hash = HashText(text, length);
+    TextEntry* oldest = &text_cache[0];
+    for (int i = 0; i < TEXT_CACHE_ENTRIES; i++) {
+        TextEntry* entry = &text_cache[i];
+        if (entry->text && entry->hash == hash && entry->length == length && entry->size == size &&
+            !SDL_memcmp(entry->text, text, length)) {
+            entry->last_used = ++text_index;
+            text_hits++;
+            return entry;
+        }
+        if (entry->last_used < oldest->last_used) {
+            oldest = entry;
+        }
+    }
+    text_misses++;
+    Free(oldest->text);
+    oldest->text = Malloc(length);
+    if (!oldest->text) {
+        oldest->last_used = 0;
+        return NULL;
+    }
+    SDL_memcpy(oldest->text, text, length);
+    oldest->hash = hash;
+    oldest->length = length;
+    oldest->size = size;
+    oldest->num_points = 0;
+    oldest->last_used = ++text_index;
+    text_entry = oldest;
+    text_failed = false;
+    DecodeText(text, length, 0, 0, size);
+    text_entry = NULL;
+    if (text_failed) {
+        Free(oldest->text);
+        oldest->text = NULL;
+        oldest->last_used = 0;
+        return NULL;
+    }
+    return oldest;
+}
+
+static void EmitText(
+    const char* text,
+    const int length,
+    const int x,
+    const int y,
+    const int size)
+{
+    const TextEntry* entry = FindText(text, length, size);
+    if (!entry) {
+        DecodeText(text, length, x, y, size);
+        return;
+    }
+    OverlayVertex vertices[TEXT_CHUNK_LINES * 2];
+    for (int i = 0; i < entry->num_points;) {
+        const int count = SDL_min(entry->num_points - i, TEXT_CHUNK_LINES * 2);
+        for (int j = 0; j < count; j++) {
+            vertices[j].x = entry->points[i + j].x + x;
+            vertices[j].y = entry->points[i + j].y + y;
+            vertices[j].color = color;
+        }
+        PushCommand(COMMAND_TYPE_OVERLAY, vertices, count * sizeof(OverlayVertex));
+        i += count;
+    }
+}
+
+static bool IsGlyph(
+    const char c)
+{
+    /* Same test as the decoder, every other character is skipped without
+     * advancing */
+    return (unsigned char) (c - 0x20) <= (0x7f - 0x20);
+}
+
+/* Finds the end of the line that starts at the text and returns the start of
+ * the next one */
+static const char* BreakText(
+    const char* text,
+    const int size,
+    int* length,
+    int* glyphs)
+{
+    const int sp2 = size + 2;
+    const char* space = NULL;
+    int space_glyphs = 0;
+    int count = 0;
+    const char* c = text;
+    for (; *c && *c != '\n'; c++) {
+        if (!IsGlyph(*c)) {
+            continue;
+        }
+        if (*c == ' ') {
+            space = c;
+            space_glyphs = count;
+        }
+        if (text_wrap > 0 && count > 0 && (count + 1) * sp2 - 2 > text_wrap) {
+            if (space) {
+                *length = space - text;
+                *glyphs = space_glyphs;
+                return space + 1;
+            }
+            *length = c - text;
+            *glyphs = count;
+            return c;
+        }
+        count++;
+    }
+    *length = c - text;
+    *glyphs = count;
+    return *c ? c + 1 : c;
+}
+
+void SDL_DrawGPUDText(
+    const char* text,
+    const float x,
+    const float y,
+    const int size)
+{
+    if (!device) {
+        return;
+    }
+    if (!text) {
+        SDL_InvalidParamError("text");
+        return;
+    }
+    if (size < 3) {
+        SDL_InvalidParamError("size");
+        return;
+    }
+    /* Same truncation as the decoder so cached and decoded lines match */
+    const int origin_x = x;
+    const int origin_y = y;
+    const int sp2 = size + 2;
+    int line_y = origin_y;
+    while (*text) {
+        if (text_clipped && line_y >= text_clip.y + text_clip.h) {
+            break;
+        }
+        int length;
+        int glyphs;
+        const char* line = text;
+        text = BreakText(text, size, &length, &glyphs);
+        if (!glyphs || (text_clipped && line_y + size <= text_clip.y)) {
+            line_y += size + size / 2;
+            continue;
+        }
+        const int width = glyphs * sp2 - 2;
+        int line_x = origin_x;
+        if (text_align == SDL_GPUD_ALIGN_CENTER) {
+            line_x += text_wrap > 0 ? (text_wrap - width) / 2 : -width / 2;
+        } else if (text_align == SDL_GPUD_ALIGN_RIGHT) {
+            line_x += text_wrap > 0 ? text_wrap - width : -width;
+        }
+        if (text_clipped) {
+            const char* start = NULL;
+            const char* end = line + length;
+            int start_x = line_x;
+            for (const char* c = line; c < line + length; c++) {
+                if (!IsGlyph(*c)) {
+                    continue;
+                }
+                if (line_x >= text_clip.x + text_clip.w) {
+                    end = c;
+                    break;
+                }
+                if (!start && line_x + size > text_clip.x) {
+                    start = c;
+                    start_x = line_x;
+                }
+                line_x += sp2;
+            }
+            if (start && start < end) {
+                EmitText(start, end - start, start_x, line_y, size);
+            }
+        } else {
+            EmitText(line, length, line_x, line_y, size);
+        }
+        line_y += size + size / 2;
+    }
+}
+
+void SDL_GetGPUDTextCache(
+    Uint64* hits,
+    Uint64* misses)
+{
+    if (hits) {
+        *hits = text_hits;
+    }
+    if (misses) {
+        *misses = text_misses;
+    }
+}
+
+void SDL_SetGPUDTextWrap(
+    const int width)
+{
+    if (width < 0) {
+        SDL_InvalidParamError("width");
+        return;
+    }
+    text_wrap = width;
+}
+
+void SDL_SetGPUDTextAlign(
+    const SDL_GPUDAlign align)
+{
+    if (align < SDL_GPUD_ALIGN_LEFT || align > SDL_GPUD_ALIGN_RIGHT) {
+        SDL_InvalidParamError("align");
+        return;
+    }
+    text_align = align;
+}
+
+void SDL_SetGPUDTextClip(
+    const SDL_Rect* rect)
+{
+    text_clipped = rect;
+    if (rect) {
+        text_clip = *rect;
+    }
+}
+
+void SDL_MeasureGPUDText(
+    const char* text,
+    const int size,
+    int* width,
+    int* height)
+{
+    if (!text) {
+        SDL_InvalidParamError("text");
+        return;
+    }
+    if (size < 3) {
+        SDL_InvalidParamError("size");
+        return;
+    }
+    int max_glyphs = 0;
+    int lines = 0;
+    while (*text) {
+        int length;
+        int glyphs;
+        text = BreakText(text, size, &length, &glyphs);
+        max_glyphs = SDL_max(max_glyphs, glyphs);
+        lines++;
+    }
+    if (width) {
+        *width = max_glyphs ? max_glyphs * (size + 2) - 2 : 0;
+    }
+    if (height) {
+        *height = lines ? (lines - 1) * (size + size / 2) + size : 0;
+    }
+}
+
+void SDL_DrawGPUDLabel(
+    const char* text,
+    const SDL_GPUDVertex* anchor,
+    const int size,
+    const bool occlude)
+{
+    if (!device) {
+        return;
+    }
+    if (!text) {
+        SDL_InvalidParamError("text");
+        return;
+    }
+    if (!anchor) {
+        SDL_InvalidParamError("anchor");
+        return;
+    }
+    if (size < 3) {
+        SDL_InvalidParamError("size");
+        return;
+    }
+    const Uint32 length = SDL_strlen(text) + 1;
+    if (label_text_size + length > label_text_capacity) {
+        const Uint32 capacity = SDL_max(1024, SDL_max(label_text_capacity * 2, label_text_size + length));
+        char* data = Realloc(label_text, capacity);
+        if (!data) {
+            return;
+        }
+        label_text = data;
+        label_text_capacity = capacity;
+    }
+    if (num_labels == label_capacity) {
+        const int capacity = SDL_max(64, label_capacity * 2);
+        Label* data = Realloc(labels, capacity * sizeof(Label));
+        if (!data) {
+            return;
+        }
+        labels = data;
+        label_capacity = capacity;
+    }
+    Label* label = &labels[num_labels++];
+    label->anchor = *anchor;
+    label->anchor.color = color;
+    TransformPoint(&label->anchor, transform);
+    label->size = size;
+    label->occlude = occlude;
+    label->text = label_text_size;
+    SDL_memcpy(label_text + label_text_size, text, length);
+    label_text_size += length;
+}
+
+void SDL_SetGPUDViewport(
+    const Uint32 width,
+    const Uint32 height)
+{
+    viewport_width = width;
+    viewport_height = height;
+}
+
+static void GetScreenMatrix(
+    float* matrix,
+    const Uint32 width,
+    const Uint32 height)
+{
+    /* Column major, same as an orthographic projection of (0, width, height,
+     * 0, -1, 1) with a zero to one depth range */
+    SDL_memset(matrix, 0, 16 * sizeof(float));
+    matrix[0] = 2.0f / width;
+    matrix[5] = -2.0f / height;
+    matrix[10] = -0.5f;
+    matrix[12] = -1.0f;
+    matrix[13] = 1.0f;
+    matrix[14] = 0.5f;
+    matrix[15] = 1.0f;
+}
+
+static bool ReserveStream(
+    StreamBuffer* buffer,
+    const Uint32 size)
+{
+    if (size <= buffer->capacity) {
+        return true;
+    }
+    const Uint32 capacity = SDL_max(size, buffer->capacity * 2);
+    Uint32* words = Realloc(buffer->words, capacity * sizeof(Uint32));
+    if (!words) {
+        return false;
+    }
+    buffer->words = words;
+    buffer->capacity = capacity;
+    return true;
+}
+
+/* A failed write ends the capture, the truncated frame is skipped when the
+ * file is opened */
+static void WriteCapture(
+    const void* matrix,
+    const bool depth)
+{
+    CaptureFrame frame = {0};
+    for (Command* command = head; command; command = command->next) {
+        frame.size += sizeof(CaptureCommand) + command->size;
+        frame.num_commands++;
+    }
+    frame.size += sizeof(CaptureFrame) - sizeof(frame.size);
+    frame.flags = depth ? CAPTURE_FLAG_DEPTH : 0;
+    SDL_memcpy(frame.matrix, matrix, sizeof(frame.matrix));
+    SDL_memcpy(frame.custom, custom_matrix, sizeof(frame.custom));
+    frame.viewport[0] = viewport_width;
+    frame.viewport[1] = viewport_height;
+    bool status = SDL_WriteIO(capture, &frame, sizeof(frame)) == sizeof(frame);
+    for (Command* command = head; command && status; command = command->next) {
+        CaptureCommand header = {command->type | command->slot << CAPTURE_SLOT_SHIFT, command->size};
+        status = SDL_WriteIO(capture, &header, sizeof(header)) == sizeof(header);
+        if (!command->transform) {
+            status = status && SDL_WriteIO(capture, command->data, command->size) == command->size;
+            continue;
+        }
+        Uint8 data[960];
+        for (Uint32 offset = 0; offset < command->size && status; offset += sizeof(data)) {
+            const Uint32 size = SDL_min(sizeof(data), command->size - offset);
+            BakeTransform(command, offset, size, data);
+            status = SDL_WriteIO(capture, data, size) == size;
+        }
+    }
+    if (!status) {
+        SDL_EndGPUDCapture();
+    }
+}
+
+/* Each streamed submit is the capture frame layout (with the command headers
+ * hoisted in front of the data) followed by the vertex words of every batch
+ * XOR'd against the batch at the same index of the previous submit, or against
+ * zero if that batch has another type, slot or size. A submit with another
+ * number of batches is a keyframe and XOR'd against zero throughout. The
+ * XOR'd words are run-length encoded per batch as tokens of (zero words << 16
+ * | literal words) followed by the literal words, so batches that did not
+ * change between submits cost a single token */
+static Uint32 EncodeStream(
+    const Uint32* words,
+    const Uint32* prev,
+    const Uint32 num_words,
+    Uint32* tokens)
+{
+    Uint32 num_tokens = 0;
+    for (Uint32 i = 0; i < num_words;) {
+        Uint32 zeros = 0;
+        Uint32 literals = 0;
+        while (i < num_words && zeros < STREAM_MAX_RUN && words[i] == (prev ? prev[i] : 0)) {
+            zeros++;
+            i++;
+        }
+        Uint32* token = &tokens[num_tokens++];
+        while (i < num_words && literals < STREAM_MAX_RUN && words[i] != (prev ? prev[i] : 0)) {
+            tokens[num_tokens++] = words[i] ^ (prev ? prev[i] : 0);
+            literals++;
+            i++;
+        }
+        *token = zeros << 16 | literals;
+    }
+    return num_tokens;
+}
+
+static void WriteStream(
+    const void* matrix,
+    const bool depth)
+{
+    Uint32 num_commands = 0;
+    Uint32 num_words = 0;
+    for (Command* command = head; command; command = command->next) {
+        num_words += command->size / sizeof(Uint32);
+        num_commands++;
+    }
+    const Uint32 num_headers = num_commands * sizeof(CaptureCommand) / sizeof(Uint32);
+    /* The previous submit moves to scratch and the encoded words follow it */
+    StreamBuffer swap = stream_send;
+    stream_send = stream_scratch;
+    stream_scratch = swap;
+    stream_send.size = num_headers + num_words;
+    stream_send.num_commands = num_commands;
+    if (!ReserveStream(&stream_send, num_headers + num_words) ||
+        !ReserveStream(&stream_scratch, stream_scratch.size + num_words * 2 + num_commands)) {
+        SDL_EndGPUDStream();
+        return;
+    }
+    CaptureCommand* commands = (CaptureCommand*) stream_send.words;
+    Uint32* words = stream_send.words + num_headers;
+    for (Command* command = head; command; command = command->next) {
+        commands->type = command->type | command->slot << CAPTURE_SLOT_SHIFT;
+        commands->size = command->size;
+        commands++;
+        if (command->transform) {
+            BakeTransform(command, 0, command->size, (Uint8*) words);
+        } else {
+            SDL_memcpy(words, command->data, command->size);
+        }
+        words += command->size / sizeof(Uint32);
+    }
+    const bool keyframe = num_commands != stream_scratch.num_commands;
+    const CaptureCommand* prev_commands = (const CaptureCommand*) stream_scratch.words;
+    const Uint32* prev = stream_scratch.words + num_headers;
+    commands = (CaptureCommand*) stream_send.words;
+    words = stream_send.words + num_headers;
+    Uint32* tokens = stream_scratch.words + stream_scratch.size;
+    Uint32 num_tokens = 0;
+    for (Uint32 i = 0; i < num_commands; i++) {
+        const bool same = !keyframe && prev_commands[i].type == commands[i].type &&
+            prev_commands[i].size == commands[i].size;
+        num_tokens += EncodeStream(words, same ? prev : NULL, commands[i].size / sizeof(Uint32), tokens + num_tokens);
+        words += commands[i].size / sizeof(Uint32);
+        if (!keyframe) {
+            prev += prev_commands[i].size / sizeof(Uint32);
+        }
+    }
+    CaptureFrame frame = {0};
+    frame.size = sizeof(CaptureFrame) - sizeof(frame.size) + num_commands * sizeof(CaptureCommand) +
+        num_tokens * sizeof(Uint32);
+    frame.flags = (depth ? CAPTURE_FLAG_DEPTH : 0) | (keyframe ? CAPTURE_FLAG_KEYFRAME : 0);
+    frame.num_commands = num_commands;
+    SDL_memcpy(frame.matrix, matrix, sizeof(frame.matrix));
+    SDL_memcpy(frame.custom, custom_matrix, sizeof(frame.custom));
+    frame.viewport[0] = viewport_width;
+    frame.viewport[1] = viewport_height;
+    bool status = SDL_WriteIO(stream, &frame, sizeof(frame)) == sizeof(frame);
+    if (status) {
+        const Uint32 size = num_commands * sizeof(CaptureCommand);
+        status = SDL_WriteIO(stream, stream_send.words, size) == size;
+    }
+    if (status) {
+        status = SDL_WriteIO(stream, tokens, num_tokens * sizeof(Uint32)) == num_tokens * sizeof(Uint32);
+    }
+    if (!status) {
+        SDL_EndGPUDStream();
+    }
+}
+
+static CachedFrame* FindCachedFrame()
+{
+    for (int i = 0; i < CACHED_FRAMES; i++) {
+        CachedFrame* cached_frame = &cached_frames[i];
+        if (!cached_frame->head || cached_frame->hash != frame_hash || cached_frame->size != frame_size ||
+            cached_frame->num_transforms > num_transforms) {
+            continue;
+        }
+        /* The hash has the transform index of every batch but not its
+         * matrix, which is compared here. Zero is always the identity */
+        Command* command = cached_frame->head;
+        for (; command; command = command->next) {
+            const int index = command->transform;
+            if (index && SDL_memcmp(&cached_frame->transforms[index], &transforms[index], sizeof(Transform))) {
+                break;
+            }
+        }
+        if (!command) {
+            cached_frame->last_used = ++frame_index;
+            return cached_frame;
+        }
+    }
+    return NULL;
+}
+
+/* Moves the GPU buffers of the recorded batches into the least recently used
+ * cached frame. The transfer buffers are left for ReleaseCommands */
+static void CacheFrame()
+{
+    CachedFrame* cached_frame = &cached_frames[0];
+    for (int i = 1; i < CACHED_FRAMES; i++) {
+        if (cached_frames[i].last_used < cached_frame->last_used) {
+            cached_frame = &cached_frames[i];
+        }
+    }
+    FreeCachedFrame(cached_frame);
+    int num_commands = 0;
+    for (Command* command = head; command; command = command->next) {
+        num_commands++;
+    }
+    Command* copies = Malloc(num_commands * sizeof(Command) + num_transforms * sizeof(Transform));
+    if (!copies) {
+        return;
+    }
+    int i = 0;
+    for (Command* command = head; command; command = command->next, i++) {
+        copies[i] = *command;
+        copies[i].next = i + 1 < num_commands ? &copies[i + 1] : NULL;
+        copies[i].transfer_buffer = NULL;
+        command->buffer = NULL;
+    }
+    cached_frame->head = copies;
+    cached_frame->transforms = (Transform*) (copies + num_commands);
+    cached_frame->num_transforms = num_transforms;
+    if (transforms) {
+        SDL_memcpy(cached_frame->transforms, transforms, num_transforms * sizeof(Transform));
+    }
+    cached_frame->hash = frame_hash;
+    cached_frame->size = frame_size;
+    cached_frame->last_used = ++frame_index;
+}
+
+/* Binds the pipeline and pushes the matrix of the uniform key if they
+ * changed, the key is -1 for the identity of labels */
+static void BindBatch(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass,
+    SDL_GPUGraphicsPipeline* pipeline,
+    const int uniform,
+    const float* base,
+    SDL_GPUGraphicsPipeline** bound_pipeline,
+    int* bound_uniform)
+{
+    static const float identity[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f,
+    };
+    if (*bound_pipeline != pipeline) {
+        *bound_pipeline = pipeline;
+        SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+        *bound_uniform = -2;
+    }
+    if (*bound_uniform == uniform) {
+        return;
+    }
+    *bound_uniform = uniform;
+    const int index = uniform & 0xFFFFFF;
+    if (uniform < 0) {
+        SDL_PushGPUVertexUniformData(command_buffer, 0, identity, sizeof(identity));
+    } else if (!index) {
+        SDL_PushGPUVertexUniformData(command_buffer, 0, base, 16 * sizeof(float));
+    } else {
+        float product[16];
+        MultiplyMatrix(product, base, transforms[index].matrix);
+        SDL_PushGPUVertexUniformData(command_buffer, 0, product, sizeof(product));
+    }
+}
+
+/* The matrix of the batch followed by its inverse, for shaders that cast
+ * rays through the pixels, false if it has none */
+static bool GetRayMatrices(
+    float* matrices,
+    const int uniform,
+    const float* base)
+{
+    const int index = uniform & 0xFFFFFF;
+    if (index) {
+        MultiplyMatrix(matrices, base, transforms[index].matrix);
+    } else {
+        SDL_memcpy(matrices, base, 16 * sizeof(float));
+    }
+    return InvertMatrix(matrices + 16, matrices);
+}
+
+static bool PushSphereMatrices(
+    SDL_GPUCommandBuffer* command_buffer,
+    const int uniform,
+    const float* base)
+{
+    float matrices[32];
+    if (!GetRayMatrices(matrices, uniform, base)) {
+        return false;
+    }
+    SDL_PushGPUFragmentUniformData(command_buffer, 0, matrices, sizeof(matrices));
+    return true;
+}
+
+/* Matches t_grid in grid.frag */
+typedef struct
+{
+    float matrices[32];
+    float color[4];
+    float center[2];
+    float spacing;
+    float radius;
+    Sint32 levels;
+    Sint32 padding[3];
+} GridUniform;
+
+static void DrawGrid(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass,
+    const CloudDraw* draw,
+    const bool screen,
+    const bool depth,
+    const float* base,
+    SDL_GPUGraphicsPipeline** bound_pipeline,
+    int* bound_uniform)
+{
+    const SDL_GPUDGrid* grid = (const SDL_GPUDGrid*) draw->cloud;
+    SDL_GPUGraphicsPipeline* pipeline;
+    if (screen) {
+        pipeline = grid_screen_pipeline;
+    } else if (depth) {
+        pipeline = grid_3d_pipeline;
+    } else {
+        pipeline = grid_2d_pipeline;
+    }
+    GridUniform uniform = {0};
+    const int uniform2 = draw->slot << 24 | draw->transform;
+    if (!GetRayMatrices(uniform.matrices, uniform2, base)) {
+        return;
+    }
+    uniform.color[0] = ((draw->color >> 24) & 0xFF) / 255.0f;
+    uniform.color[1] = ((draw->color >> 16) & 0xFF) / 255.0f;
+    uniform.color[2] = ((draw->color >> 8) & 0xFF) / 255.0f;
+    uniform.color[3] = (draw->color & 0xFF) / 255.0f;
+    uniform.center[0] = draw->center[0];
+    uniform.center[1] = draw->center[1];
+    uniform.spacing = draw->size;
+    uniform.radius = grid->radius;
+    uniform.levels = grid->levels;
+    BindBatch(command_buffer, render_pass, pipeline, uniform2, base, bound_pipeline, bound_uniform);
+    SDL_PushGPUFragmentUniformData(command_buffer, 0, &uniform, sizeof(uniform));
+    SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
+}
+
+static void DrawTrails(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass,
+    const CloudDraw* draw,
+    const bool screen,
+    const bool depth,
+    const float* base,
+    SDL_GPUGraphicsPipeline** bound_pipeline,
+    int* bound_uniform)
+{
+    const SDL_GPUDTrails* trails = (const SDL_GPUDTrails*) draw->cloud;
+    SDL_GPUGraphicsPipeline* pipeline;
+    if (screen) {
+        pipeline = trail_screen_pipeline;
+    } else if (depth) {
+        pipeline = trail_3d_pipeline;
+    } else {
+        pipeline = trail_2d_pipeline;
+    }
+    BindBatch(command_buffer, render_pass, pipeline, draw->slot << 24 | draw->transform, base,
+        bound_pipeline, bound_uniform);
+    SDL_BindGPUVertexStorageBuffers(render_pass, 0, &trails->cloud.buffer, 1);
+    /* Matches t_trail in trail.vert */
+    const Uint32 uniform[4] = {trails->num_trails, trails->length, draw->first, draw->count};
+    SDL_PushGPUVertexUniformData(command_buffer, 1, uniform, sizeof(uniform));
+    SDL_DrawGPUPrimitives(render_pass, 2 * draw->count * trails->num_trails, 1, 0, 0);
+}
+
+static void DrawGraph(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass,
+    const CloudDraw* draw,
+    const bool screen,
+    const bool depth,
+    const float* base,
+    SDL_GPUGraphicsPipeline** bound_pipeline,
+    int* bound_uniform)
+{
+    const SDL_GPUDGraph* graph = (const SDL_GPUDGraph*) draw->cloud;
+    SDL_GPUGraphicsPipeline* pipeline;
+    if (screen) {
+        pipeline = graph_screen_pipeline;
+    } else if (depth) {
+        pipeline = graph_3d_pipeline;
+    } else {
+        pipeline = graph_2d_pipeline;
+    }
+    BindBatch(command_buffer, render_pass, pipeline, draw->slot << 24 | draw->transform, base,
+        bound_pipeline, bound_uniform);
+    SDL_BindGPUVertexStorageBuffers(render_pass, 0, &graph->cloud.buffer, 1);
+    /* Matches t_graph in graph.vert */
+    const Uint32 uniform[4] = {graph->capacity, draw->first, graph->color};
+    SDL_PushGPUVertexUniformData(command_buffer, 1, uniform, sizeof(uniform));
+    SDL_DrawGPUPrimitives(render_pass, draw->count, 1, 0, 0);
+}
+
+/* Every instance is a quad around one point, sized in pixels of the
+ * viewport, so the stride is only a step of the instance index */
+static void DrawPoints(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass,
+    const CloudDraw* draw,
+    const bool screen,
+    const bool depth,
+    const float* base,
+    SDL_GPUGraphicsPipeline** bound_pipeline,
+    int* bound_uniform)
+{
+    if (!viewport_width || !viewport_height) {
+        SDL_SetError("Point clouds need SDL_SetGPUDViewport");
+        return;
+    }
+    SDL_GPUGraphicsPipeline* pipeline;
+    if (screen) {
+        pipeline = point_screen_pipeline;
+    } else if (depth) {
+        pipeline = point_3d_pipeline;
+    } else {
+        pipeline = point_2d_pipeline;
+    }
+    BindBatch(command_buffer, render_pass, pipeline, draw->slot << 24 | draw->transform, base,
+        bound_pipeline, bound_uniform);
+    SDL_BindGPUVertexStorageBuffers(render_pass, 0, &draw->cloud->buffer, 1);
+    struct
+    {
+        float size[2];
+        Uint32 first;
+        Uint32 stride;
+    } uniform;
+    uniform.size[0] = draw->size / viewport_width;
+    uniform.size[1] = draw->size / viewport_height;
+    uniform.first = draw->first;
+    uniform.stride = draw->stride;
+    SDL_PushGPUVertexUniformData(command_buffer, 1, &uniform, sizeof(uniform));
+    SDL_DrawGPUPrimitives(render_pass, 4, (draw->count + draw->stride - 1) / draw->stride, 0, 0);
+}
+
+/* Returns the pipelines of the layout, creating them if it is new */
+static const WireframePipeline* GetWireframePipeline(
+    const Uint32 stride,
+    const Uint32 offset)
+{
+    for (int i = 0; i < num_wireframe_pipelines; i++) {
+        if (wireframe_pipelines[i].stride == stride && wireframe_pipelines[i].offset == offset) {
+            return &wireframe_pipelines[i];
+        }
+    }
+    if (num_wireframe_pipelines == WIREFRAME_PIPELINES) {
+        SDL_SetError("Too many wireframe vertex layouts");
+        return NULL;
+    }
+    WireframePipeline* entry = &wireframe_pipelines[num_wireframe_pipelines];
+    SDL_GPUColorTargetDescription color_target = {
+        .format = target_color_format,
+        .blend_state = {
+            .enable_blend = true,
+            .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+            .color_blend_op = SDL_GPU_BLENDOP_ADD,
+            .src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
+            .src_alpha_blendfactor = GetAlphaBlendFactor(),
+            .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+        },
+    };
+    /* Positions come from the caller's layout and the color from one
+     * instance of the color buffer */
+    SDL_GPUGraphicsPipelineCreateInfo pipeline_info = {
+        .vertex_shader = vertex_shader,
+        .fragment_shader = fragment_shader,
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .num_color_targets = 1,
+            .color_target_descriptions = &color_target,
+            .depth_stencil_format = target_depth_format,
+        },
+        .vertex_input_state = {
+            .num_vertex_attributes = 2,
+            .vertex_attributes = (SDL_GPUVertexAttribute[]) {{
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                .location = 0,
+                .buffer_slot = 0,
+                .offset = offset,
+            }, {
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+                .location = 1,
+                .buffer_slot = 1,
+                .offset = 0,
+            }},
+            .num_vertex_buffers = 2,
+            .vertex_buffer_descriptions = (SDL_GPUVertexBufferDescription[]) {{
+                .slot = 0,
+                .pitch = stride,
+            }, {
+                .slot = 1,
+                .pitch = sizeof(Uint32),
+                .input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE,
+            }},
+        },
+        /* Pulled toward the camera so the edges win against the caller's
+         * own depth of the same triangles */
+        .rasterizer_state = {
+            .fill_mode = SDL_GPU_FILLMODE_LINE,
+            .cull_mode = SDL_GPU_CULLMODE_NONE,
+            .depth_bias_constant_factor = -1.0f,
+            .depth_bias_slope_factor = -1.0f,
+        },
+        .depth_stencil_state = {
+            .compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL,
+        },
+    };
+    for (int variant = 0; variant < 3; variant++) {
+        pipeline_info.target_info.has_depth_stencil_target = variant != 0;
+        pipeline_info.rasterizer_state.enable_depth_bias = variant == 1;
+        pipeline_info.depth_stencil_state.enable_depth_test = variant == 1;
+        entry->pipelines[variant] = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+        if (!entry->pipelines[variant]) {
+            for (int i = 0; i < variant; i++) {
+                SDL_ReleaseGPUGraphicsPipeline(device, entry->pipelines[i]);
+            }
+            SDL_zero(*entry);
+            return NULL;
+        }
+    }
+    entry->stride = stride;
+    entry->offset = offset;
+    num_wireframe_pipelines++;
+    return entry;
+}
+
+static void DrawWireframe(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass,
+    const CloudDraw* draw,
+    const int index,
+    const int variant,
+    const float* base,
+    SDL_GPUGraphicsPipeline** bound_pipeline,
+    int* bound_uniform)
+{
+    const SDL_GPUDMesh* mesh = (const SDL_GPUDMesh*) draw->cloud;
+    if (!cloud_colors) {
+        return;
+    }
+    BindBatch(command_buffer, render_pass, mesh->pipeline->pipelines[variant], draw->slot << 24 | draw->transform, base,
+        bound_pipeline, bound_uniform);
+    SDL_GPUBufferBinding bindings[2] = {0};
+    bindings[0].buffer = mesh->cloud.buffer;
+    bindings[1].buffer = cloud_colors;
+    bindings[1].offset = index * sizeof(Uint32);
+    SDL_BindGPUVertexBuffers(render_pass, 0, bindings, 2);
+    if (mesh->cloud.index_buffer) {
+        SDL_GPUBufferBinding binding = {0};
+        binding.buffer = mesh->cloud.index_buffer;
+        SDL_BindGPUIndexBuffer(render_pass, &binding, mesh->index_size);
+        SDL_DrawGPUIndexedPrimitives(render_pass, draw->count, 1, 0, 0, 0);
+    } else {
+        SDL_DrawGPUPrimitives(render_pass, draw->count, 1, 0, 0);
+    }
+}
+
+/* Glyphs read the glyph table and offset their strokes in pixels */
+static bool BindGlyphs(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass)
+{
+    if (!viewport_width || !viewport_height) {
+        return SDL_SetError("Labels need SDL_SetGPUDViewport");
+    }
+    SDL_BindGPUVertexStorageBuffers(render_pass, 0, &glyph_buffer, 1);
+    /* Matches t_label in label.vert */
+    const float scale[2] = {2.0f / viewport_width, 2.0f / viewport_height};
+    SDL_PushGPUVertexUniformData(command_buffer, 1, scale, sizeof(scale));
+    return true;
+}
+
+/* Passes are opaque, blended translucent and then the screen slot on top.
+ * Without the blend targets, translucent batches are drawn with the opaque
+ * ones in submission order */
+static void DrawCommands(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass* render_pass,
+    Command* commands,
+    const bool depth,
+    const void* matrix,
+    const int first_pass,
+    const int last_pass,
+    const bool blended)
+{
+    SDL_GPUGraphicsPipeline* pipeline1 = NULL;
+    SDL_GPUGraphicsPipeline* pipeline2 = NULL;
+    /* Which slot and transform the uniform holds */
+    int uniform1 = -2;
+    int uniform2 = -2;
+    bool screen = false;
+    for (Command* command = commands; command; command = command->next) {
+        screen |= command->slot == SDL_GPUD_SLOT_SCREEN;
+    }
+    for (int i = 0; i < num_cloud_draws; i++) {
+        screen |= cloud_draws[i].slot == SDL_GPUD_SLOT_SCREEN;
+    }
+    screen |= shape_vertices[SDL_GPUD_SLOT_SCREEN] != 0;
+    float screen_matrix[16];
+    if (screen) {
+        if (viewport_width && viewport_height) {
+            GetScreenMatrix(screen_matrix, viewport_width, viewport_height);
+        } else {
+            SDL_SetError("The screen slot needs SDL_SetGPUDViewport");
+            screen = false;
+        }
+    }
+    const float* bases[3] = {matrix, screen_matrix, custom_matrix};
+    for (int pass = first_pass; pass <= last_pass; pass++) {
+        if ((pass == 1 && !blended) || (pass == 2 && !screen)) {
+            continue;
+        }
+        for (Command* command = commands; command; command = command->next) {
+            if (!command->buffer || (command->type == COMMAND_TYPE_TRANSLUCENT && blended) != (pass == 1) ||
+                (command->slot == SDL_GPUD_SLOT_SCREEN) != (pass == 2)) {
+                continue;
+            }
+            switch (command->type) {
+            case COMMAND_TYPE_LINE:
+                if (pass == 2 && depth) {
+                    pipeline2 = label_pipeline;
+                } else if (depth) {
+                    pipeline2 = line_3d_pipeline;
+                } else {
+                    pipeline2 = line_2d_pipeline;
+                }
+                break;
+            case COMMAND_TYPE_POLY:
+            case COMMAND_TYPE_TRANSLUCENT:
+                if (pass == 1) {
+                    pipeline2 = depth ? translucent_3d_pipeline : translucent_2d_pipeline;
+                } else if (pass == 2 && depth) {
+                    pipeline2 = poly_screen_pipeline;
+                } else if (depth) {
+                    pipeline2 = poly_3d_pipeline;
+                } else {
+                    pipeline2 = poly_2d_pipeline;
+                }
+                break;
+            case COMMAND_TYPE_OVERLAY:
+                if (pass == 2 && depth) {
+                    pipeline2 = overlay_screen_pipeline;
+                } else if (depth) {
+                    pipeline2 = overlay_3d_pipeline;
+                } else {
+                    pipeline2 = overlay_2d_pipeline;
+                }
+                break;
+            case COMMAND_TYPE_LABEL:
+                pipeline2 = depth ? label_pipeline : line_2d_pipeline;
+                break;
+            case COMMAND_TYPE_LABEL_OCCLUDED:
+                pipeline2 = depth ? label_occluded_pipeline : line_2d_pipeline;
+                break;
+            case COMMAND_TYPE_SPHERE:
+                pipeline2 = depth ? sphere_3d_pipeline : sphere_2d_pipeline;
+                break;
+            case COMMAND_TYPE_GLYPH:
+                pipeline2 = depth ? glyph_pipeline : glyph_2d_pipeline;
+                break;
+            case COMMAND_TYPE_GLYPH_OCCLUDED:
+                pipeline2 = depth ? glyph_occluded_pipeline : glyph_2d_pipeline;
+                break;
+            }
+            /* Spheres and glyphs replayed on a device without a build for them */
+            if (!pipeline2) {
+                continue;
+            }
+            if (command->type == COMMAND_TYPE_LABEL || command->type == COMMAND_TYPE_LABEL_OCCLUDED) {
+                uniform2 = -1;
+            } else {
+                uniform2 = command->slot << 24 | command->transform;
+            }
+            BindBatch(command_buffer, render_pass, pipeline2, uniform2, bases[command->slot], &pipeline1, &uniform1);
+            if (command->type == COMMAND_TYPE_SPHERE &&
+                !PushSphereMatrices(command_buffer, uniform2, bases[command->slot])) {
+                continue;
+            }
+            const bool glyphs = command->type == COMMAND_TYPE_GLYPH || command->type == COMMAND_TYPE_GLYPH_OCCLUDED;
+            if (glyphs && !BindGlyphs(command_buffer, render_pass)) {
+                continue;
+            }
+            SDL_GPUBufferBinding binding = {0};
+            binding.buffer = command->buffer;
+            binding.offset = command->offset;
+            SDL_BindGPUVertexBuffers(render_pass, 0, &binding, 1);
+            if (command->type == COMMAND_TYPE_OVERLAY) {
+                SDL_DrawGPUPrimitives(render_pass, command->size / sizeof(OverlayVertex), 1, 0, 0);
+            } else if (command->type == COMMAND_TYPE_SPHERE) {
+                SDL_DrawGPUPrimitives(render_pass, 4, command->size / GetPrimitiveSize(command->type), 0, 0);
+            } else if (glyphs) {
+                SDL_DrawGPUPrimitives(render_pass, 2 * GLYPH_MAX_STROKES, command->size / GetPrimitiveSize(command->type),
+                    0, 0);
+            } else {
+                SDL_DrawGPUPrimitives(render_pass, command->size / sizeof(SDL_GPUDVertex), 1, 0, 0);
+            }
+        }
+        /* Point clouds, grids, graphs and trails are drawn with the opaque
+         * primitives */
+        for (int i = 0; i < num_cloud_draws && (pass == 0 || pass == 2); i++) {
+            const CloudDraw* draw = &cloud_draws[i];
+            const SDL_GPUDPointCloud* cloud = draw->cloud;
+            if ((draw->slot == SDL_GPUD_SLOT_SCREEN) != (pass == 2)) {
+                continue;
+            }
+            if (cloud->type == CLOUD_TYPE_MESH) {
+                const int variant = pass == 2 && depth ? 2 : depth;
+                DrawWireframe(command_buffer, render_pass, draw, i, variant, bases[draw->slot], &pipeline1,
+                    &uniform1);
+                continue;
+            }
+            if (cloud->type == CLOUD_TYPE_TRAILS) {
+                DrawTrails(command_buffer, render_pass, draw, pass == 2 && depth, depth, bases[draw->slot],
+                    &pipeline1, &uniform1);
+                continue;
+            }
+            if (cloud->type == CLOUD_TYPE_GRID) {
+                DrawGrid(command_buffer, render_pass, draw, pass == 2 && depth, depth, bases[draw->slot],
+                    &pipeline1, &uniform1);
+                continue;
+            }
+            if (cloud->type == CLOUD_TYPE_GRAPH) {
+                DrawGraph(command_buffer, render_pass, draw, pass == 2 && depth, depth, bases[draw->slot],
+                    &pipeline1, &uniform1);
+                continue;
+            }
+            DrawPoints(command_buffer, render_pass, draw, pass == 2 && depth, depth, bases[draw->slot],
+                &pipeline1, &uniform1);
+        }
+        /* Shapes expanded by ExpandShapes, one indirect draw per slot */
+        for (int i = 0; i < 3 && pass != 1; i++) {
+            if (!shape_vertices[i] || (i == SDL_GPUD_SLOT_SCREEN) != (pass == 2)) {
+                continue;
+            }
+            if (pass == 2 && depth) {
+                pipeline2 = label_pipeline;
+            } else {
+                pipeline2 = depth ? line_3d_pipeline : line_2d_pipeline;
+            }
+            BindBatch(command_buffer, render_pass, pipeline2, i << 24, bases[i], &pipeline1, &uniform1);
+            SDL_GPUBufferBinding binding = {0};
+            binding.buffer = shape_vertex_buffer;
+            SDL_BindGPUVertexBuffers(render_pass, 0, &binding, 1);
+            SDL_DrawGPUPrimitivesIndirect(render_pass, shape_draw_buffer, i * sizeof(SDL_GPUIndirectDrawCommand), 1);
+        }
+        if (pass == 0 && append_buffer) {
+            pipeline2 = depth ? line_3d_pipeline : line_2d_pipeline;
+            BindBatch(command_buffer, render_pass, pipeline2, 0, bases[0], &pipeline1, &uniform1);
+            SDL_GPUBufferBinding binding = {0};
+            binding.buffer = append_buffer;
+            SDL_BindGPUVertexBuffers(render_pass, 0, &binding, 1);
+            SDL_DrawGPUPrimitivesIndirect(render_pass, append_counter, 0, 1);
+        }
+    }
+}
+
+static void AddShapeArc(
+    ShapeArc* arcs,
+    int* count,
+    const float* center,
+    const float* u,
+    const float* v,
+    const float radius,
+    const float start,
+    const float end)
+{
+    ShapeArc* arc = &arcs[(*count)++];
+    for (int j = 0; j < 3; j++) {
+        arc->center[j] = center[j];
+        arc->u[j] = radius * u[j];
+        arc->v[j] = radius * v[j];
+    }
+    arc->start = start;
+    arc->end = end;
+    arc->segments = SDL_clamp((int) SDL_ceilf(shape_detail * SDL_fabsf(end - start) / (2.0f * SDL_PI_F)), 1, shape_detail);
+}
+
+/* Lines are a quarter arc from the start along v, the cosine only scales
+ * a zero u */
+static void AddShapeLine(
+    ShapeArc* arcs,
+    int* count,
+    const float* start,
+    const float* end)
+{
+    ShapeArc* arc = &arcs[(*count)++];
+    for (int j = 0; j < 3; j++) {
+        arc->center[j] = start[j];
+        arc->u[j] = 0.0f;
+        arc->v[j] = end[j] - start[j];
+    }
+    arc->start = 0.0f;
+    arc->end = SDL_PI_F / 2.0f;
+    arc->segments = 1;
+}
+
+/* Orthonormal basis around a unit axis, from Duff et al. 2017 */
+static void GetShapeBasis(
+    const float* axis,
+    float* u,
+    float* v)
+{
+    const float sign = axis[2] < 0.0f ? -1.0f : 1.0f;
+    const float a = -1.0f / (sign + axis[2]);
+    const float b = axis[0] * axis[1] * a;
+    u[0] = 1.0f + sign * axis[0] * axis[0] * a;
+    u[1] = sign * b;
+    u[2] = -sign * axis[0];
+    v[0] = b;
+    v[1] = sign + axis[1] * axis[1] * a;
+    v[2] = -axis[1];
+}
+
+/* Four lines between two rings, along +u, +v, -u and -v */
+static void AddShapeSides(
+    ShapeArc* arcs,
+    int* count,
+    const float* start,
+    const float* end,
+    const float* u,
+    const float* v,
+    const float start_radius,
+    const float end_radius)
+{
+    for (int i = 0; i < 4; i++) {
+        const float* side = i & 1 ? v : u;
+        const float sign = i & 2 ? -1.0f : 1.0f;
+        float a[3];
+        float b[3];
+        for (int j = 0; j < 3; j++) {
+            a[j] = start[j] + sign * start_radius * side[j];
+            b[j] = end[j] + sign * end_radius * side[j];
+        }
+        AddShapeLine(arcs, count, a, b);
+    }
+}
+
+/* Breaks a shape into at most SHAPE_MAX_ARCS arcs and lines, the same work
+ * at any detail */
+static int GetShapeArcs(
+    const Shape* shape,
+    ShapeArc* arcs)
+{
+    const float* params = shape->params;
+    int count = 0;
+    if (shape->type == SHAPE_TYPE_FRUSTUM) {
+        float corners[8][3];
+        for (int j = 0; j < 8; j++) {
+            const float ndc[3] = {j & 1 ? 1.0f : -1.0f, j & 2 ? 1.0f : -1.0f, j & 4 ? 1.0f : 0.0f};
+            float world[4];
+            for (int k = 0; k < 4; k++) {
+                world[k] = params[k] * ndc[0] + params[k + 4] * ndc[1] + params[k + 8] * ndc[2] + params[k + 12];
+            }
+            for (int k = 0; k < 3; k++) {
+                corners[j][k] = world[k] / world[3];
+            }
+        }
+        for (int j = 0; j < 8; j++) {
+            for (int bit = 1; bit < 8; bit <<= 1) {
+                if (!(j & bit)) {
+                    AddShapeLine(arcs, &count, corners[j], corners[j | bit]);
+                }
+            }
+        }
+    } else {
+        const float* start = &params[0];
+        float axis[3] = {params[3], params[4], params[5]};
+        if (shape->type != SHAPE_TYPE_ARC) {
+            for (int j = 0; j < 3; j++) {
+                axis[j] -= start[j];
+            }
+        }
+        const float length = SDL_sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+        if (length < SDL_FLT_EPSILON) {
+            return 0;
+        }
+        for (int j = 0; j < 3; j++) {
+            axis[j] /= length;
+        }
+        const float* end = &params[3];
+        const float radius = params[6];
+        float u[3];
+        float v[3];
+        GetShapeBasis(axis, u, v);
+        switch (shape->type) {
+        case SHAPE_TYPE_ARC:
+            AddShapeArc(arcs, &count, start, u, v, radius, params[7], params[8]);
+            break;
+        case SHAPE_TYPE_CYLINDER:
+        case SHAPE_TYPE_CAPSULE:
+            AddShapeArc(arcs, &count, start, u, v, radius, 0.0f, 2.0f * SDL_PI_F);
+            AddShapeArc(arcs, &count, end, u, v, radius, 0.0f, 2.0f * SDL_PI_F);
+            AddShapeSides(arcs, &count, start, end, u, v, radius, radius);
+            if (shape->type == SHAPE_TYPE_CAPSULE) {
+                const float back[3] = {-axis[0], -axis[1], -axis[2]};
+                AddShapeArc(arcs, &count, end, u, axis, radius, 0.0f, SDL_PI_F);
+                AddShapeArc(arcs, &count, end, v, axis, radius, 0.0f, SDL_PI_F);
+                AddShapeArc(arcs, &count, start, u, back, radius, 0.0f, SDL_PI_F);
+                AddShapeArc(arcs, &count, start, v, back, radius, 0.0f, SDL_PI_F);
+            }
+            break;
+        case SHAPE_TYPE_CONE:
+            AddShapeArc(arcs, &count, end, u, v, radius, 0.0f, 2.0f * SDL_PI_F);
+            AddShapeSides(arcs, &count, start, end, u, v, 0.0f, radius);
+            break;
+        case SHAPE_TYPE_ARROW:
+        {
+            const float size = SDL_min(radius, length);
+            float base[3];
+            for (int j = 0; j < 3; j++) {
+                base[j] = end[j] - axis[j] * size;
+            }
+            AddShapeLine(arcs, &count, start, end);
+            AddShapeArc(arcs, &count, base, u, v, size * 0.5f, 0.0f, 2.0f * SDL_PI_F);
+            AddShapeSides(arcs, &count, base, end, u, v, size * 0.5f, 0.0f);
+            break;
+        }
+        case SHAPE_TYPE_FRUSTUM:
+            break;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        arcs[i].color = shape->color;
+        arcs[i].transform = shape->transform;
+        arcs[i].slot = shape->slot;
+        arcs[i].padding = 0;
+    }
+    return count;
+}
+
+/* Walks the arc by rotating the previous point, two trig calls per arc */
+static void ExpandShapeArc(
+    SDL_GPUDVertex* vertices,
+    int* count,
+    const ShapeArc* arc)
+{
+    const float step = (arc->end - arc->start) / arc->segments;
+    const float step_cos = SDL_cosf(step);
+    const float step_sin = SDL_sinf(step);
+    float c = SDL_cosf(arc->start);
+    float s = SDL_sinf(arc->start);
+    SDL_GPUDVertex* vertex = &vertices[*count];
+    for (Uint32 i = 0; i <= arc->segments; i++) {
+        SDL_GPUDVertex point;
+        point.x = arc->center[0] + c * arc->u[0] + s * arc->v[0];
+        point.y = arc->center[1] + c * arc->u[1] + s * arc->v[1];
+        point.z = arc->center[2] + c * arc->u[2] + s * arc->v[2];
+        point.color = arc->color;
+        if (i) {
+            *vertex++ = point;
+        }
+        if (i < arc->segments) {
+            *vertex++ = point;
+        }
+        const float temp = c * step_cos - s * step_sin;
+        s = s * step_cos + c * step_sin;
+        c = temp;
+    }
+    *count += 2 * arc->segments;
+}
+
+/* Expands the shapes into line batches on the CPU, for the submits that
+ * cannot use ExpandShapes */
+static void PushShapes()
+{
+    SDL_GPUDVertex vertices[SHAPE_MAX_VERTICES];
+    ShapeArc arcs[SHAPE_MAX_ARCS];
+    for (int i = 0; i < num_shapes; i++) {
+        const int num_arcs = GetShapeArcs(&shapes[i], arcs);
+        int count = 0;
+        for (int j = 0; j < num_arcs; j++) {
+            ExpandShapeArc(vertices, &count, &arcs[j]);
+        }
+        transform = shapes[i].transform;
+        slot = shapes[i].slot;
+        PushCommand(COMMAND_TYPE_LINE, vertices, count * sizeof(SDL_GPUDVertex));
+    }
+    num_shapes = 0;
+}
+
+/* Keeps the shapes as arcs for ExpandShapes, with the vertex count of every
+ * slot so the draws can start at the right place in the vertex buffer */
+static void PackShapes()
+{
+    for (int i = 0; i < num_shapes; i++) {
+        if (num_shape_arcs + SHAPE_MAX_ARCS > shape_arc_capacity) {
+            const int capacity = SDL_max(256, shape_arc_capacity * 2);
+            ShapeArc* data = Realloc(shape_arcs, capacity * sizeof(ShapeArc));
+            if (!data) {
+                break;
+            }
+            shape_arcs = data;
+            shape_arc_capacity = capacity;
+        }
+        ShapeArc* arcs = &shape_arcs[num_shape_arcs];
+        const int count = GetShapeArcs(&shapes[i], arcs);
+        for (int j = 0; j < count; j++) {
+            shape_vertices[arcs[j].slot] += 2 * arcs[j].segments;
+        }
+        num_shape_arcs += count;
+    }
+    num_shapes = 0;
+}
+
+/* One instance per glyph with strokes: the anchor, then the pen in pixels,
+ * the size and the glyph */
+static void PushGlyphs(
+    const Label* label)
+{
+    const CommandType type = label->occlude ? COMMAND_TYPE_GLYPH_OCCLUDED : COMMAND_TYPE_GLYPH;
+    const char* text = label_text + label->text;
+    int glyphs = 0;
+    for (const char* c = text; *c; c++) {
+        glyphs += IsGlyph(*c);
+    }
+    int x = -(glyphs * (label->size + 2) - 2) / 2;
+    SDL_GPUDVertex vertices[64];
+    int count = 0;
+    for (const char* c = text; *c; c++) {
+        if (!IsGlyph(*c)) {
+            continue;
+        }
+        const Uint32 glyph = (unsigned char) (*c - 0x20);
+        if (glyph_counts[glyph]) {
+            vertices[count++] = label->anchor;
+            vertices[count++] = (SDL_GPUDVertex) {(float) x, (float) label->size, 0.0f, glyph};
+        }
+        if (count == SDL_arraysize(vertices)) {
+            PushCommand(type, vertices, sizeof(vertices));
+            count = 0;
+        }
+        x += label->size + 2;
+    }
+    if (count) {
+        PushCommand(type, vertices, count * sizeof(SDL_GPUDVertex));
+    }
+}
+
+/* Pushes the glyphs of each label, or without a build for the device projects
+ * its anchor and lays its text out around it in pixels. Labels behind the
+ * camera or outside the depth range are dropped, by label.vert for glyphs */
+static void PushLabels(
+    const float* matrix)
+{
+    if (!num_labels) {
+        return;
+    }
+    if (!viewport_width || !viewport_height) {
+        SDL_SetError("Labels need SDL_SetGPUDViewport");
+        num_labels = 0;
+        label_text_size = 0;
+        return;
+    }
+    for (int i = 0; i < num_labels; i++) {
+        const Label* label = &labels[i];
+        if (label_vertex_shader) {
+            PushGlyphs(label);
+            continue;
+        }
+        const SDL_GPUDVertex* anchor = &label->anchor;
+        float clip[4];
+        for (int j = 0; j < 4; j++) {
+            clip[j] = matrix[j] * anchor->x + matrix[j + 4] * anchor->y + matrix[j + 8] * anchor->z + matrix[j + 12];
+        }
+        if (clip[3] < SDL_FLT_EPSILON || clip[2] < 0.0f || clip[2] > clip[3]) {
+            continue;
+        }
+        const char* text = label_text + label->text;
+        int length = 0;
+        int glyphs = 0;
+        for (const char* c = text; *c; c++) {
+            glyphs += IsGlyph(*c);
+            length++;
+        }
+        text_origin[0] = clip[0] / clip[3];
+        text_origin[1] = clip[1] / clip[3];
+        text_origin[2] = clip[2] / clip[3];
+        text_label = label;
+        DecodeText(text, length, -(glyphs * (label->size + 2) - 2) / 2, -label->size, label->size);
+        text_label = NULL;
+    }
+    num_labels = 0;
+    label_text_size = 0;
+}
+
+/* Every impostor is the center and radius of a sphere batch. Without a build
+ * for the device, they are pushed as cubes instead */
+static void PushImpostors()
+{
+    if (!num_impostor_points) {
+        return;
+    }
+    if (!sphere_3d_pipeline) {
+        SDL_SetError("Missing impostor shader build, rerun build_shaders.sh");
+    }
+    for (int i = 0; i < num_impostor_points; i++) {
+        const DeferredPoint* point = &impostor_points[i];
+        if (!sphere_3d_pipeline) {
+            PushPoint(COMMAND_TYPE_POLY, &point->center, point->radius, point->center.color);
+            continue;
+        }
+        SDL_GPUDVertex vertices[2] = {point->center, {point->radius, 0.0f, 0.0f, 0}};
+        PushCommand(COMMAND_TYPE_SPHERE, vertices, sizeof(vertices));
+    }
+    num_impostor_points = 0;
+}
+
+/* Sorts the translucent points far to near with an LSD radix sort over
+ * (depth << 32 | index) and pushes them. Depth is the clip w for perspective
+ * matrices and the clip z otherwise, flipped so that the sort is ascending */
+static void PushTranslucents(
+    const float* matrix)
+{
+    if (!num_translucents) {
+        return;
+    }
+    if (translucency == SDL_GPUD_TRANSLUCENCY_BLENDED && !translucent_3d_pipeline) {
+        SDL_SetError("Missing blended translucency shader build, rerun build_shaders.sh");
+    } else if (translucency == SDL_GPUD_TRANSLUCENCY_BLENDED) {
+        for (int i = 0; i < num_translucents; i++) {
+            const DeferredPoint* translucent = &translucents[i];
+            PushPoint(COMMAND_TYPE_TRANSLUCENT, &translucent->center, translucent->radius, translucent->center.color);
+        }
+        num_translucents = 0;
+        return;
+    }
+    if (sort_capacity < num_translucents * 2) {
+        Uint64* data = Realloc(sort_keys, num_translucents * 2 * sizeof(Uint64));
+        if (!data) {
+            num_translucents = 0;
+            return;
+        }
+        sort_keys = data;
+        sort_capacity = num_translucents * 2;
+    }
+    const bool perspective = matrix[3] != 0.0f || matrix[7] != 0.0f || matrix[11] != 0.0f;
+    const int row = perspective ? 3 : 2;
+    Uint64* keys = sort_keys;
+    Uint64* swap = sort_keys + num_translucents;
+    for (int i = 0; i < num_translucents; i++) {
+        const SDL_GPUDVertex* center = &translucents[i].center;
+        const float depth = matrix[row] * center->x + matrix[row + 4] * center->y +
+            matrix[row + 8] * center->z + matrix[row + 12];
+        Uint32 bits;
+        SDL_memcpy(&bits, &depth, sizeof(bits));
+        bits ^= (bits >> 31) ? 0xFFFFFFFF : 0x80000000;
+        keys[i] = (Uint64) ~bits << 32 | (Uint32) i;
+    }
+    /* Three 11-bit digits, all histograms gathered in one read */
+    static int offsets[3][1 << SORT_RADIX_BITS];
+    SDL_memset(offsets, 0, sizeof(offsets));
+    for (int i = 0; i < num_translucents; i++) {
+        for (int j = 0; j < 3; j++) {
+            offsets[j][(keys[i] >> (32 + j * SORT_RADIX_BITS)) & SORT_RADIX_MASK]++;
+        }
+    }
+    for (int j = 0; j < 3; j++) {
+        const int shift = 32 + j * SORT_RADIX_BITS;
+        /* Skip digits shared by every key, common for the high digit */
+        if (offsets[j][(keys[0] >> shift) & SORT_RADIX_MASK] == num_translucents) {
+            continue;
+        }
+        int offset = 0;
+        for (int i = 0; i < (1 << SORT_RADIX_BITS); i++) {
+            const int count = offsets[j][i];
+            offsets[j][i] = offset;
+            offset += count;
+        }
+        for (int i = 0; i < num_translucents; i++) {
+            swap[offsets[j][(keys[i] >> shift) & SORT_RADIX_MASK]++] = keys[i];
+        }
+        Uint64* temp = keys;
+        keys = swap;
+        swap = temp;
+    }
+    for (int i = 0; i < num_translucents; i++) {
+        const DeferredPoint* translucent = &translucents[(Uint32) keys[i]];
+        PushPoint(COMMAND_TYPE_POLY, &translucent->center, translucent->radius, translucent->center.color);
+    }
+    num_translucents = 0;
+}
+
+/* Expands everything kept compact until submit. Shapes are expanded under
+ * the transform they were recorded with, the rest is already transformed */
+static void PushDeferred(
+    const float* matrix)
+{
+    const SDL_GPUDSlot previous = slot;
+    PushShapes();
+    transform = 0;
+    slot = SDL_GPUD_SLOT_WORLD;
+    PushLabels(matrix);
+    PushImpostors();
+    PushTranslucents(matrix);
+    slot = previous;
+}
+
+static bool UpdateOverlay()
+{
+    if (!viewport_width || !viewport_height) {
+        return SDL_SetError("The overlay needs SDL_SetGPUDViewport");
+    }
+    const Uint32 width = SDL_max(viewport_width / overlay_scale, 1);
+    const Uint32 height = SDL_max(viewport_height / overlay_scale, 1);
+    if (overlay_texture && overlay_width == width && overlay_height == height) {
+        return true;
+    }
+    SDL_ReleaseGPUTexture(device, overlay_texture);
+    SDL_ReleaseGPUTexture(device, overlay_depth_texture);
+    overlay_texture = NULL;
+    overlay_depth_texture = NULL;
+    overlay_width = 0;
+    overlay_height = 0;
+    SDL_GPUTextureCreateInfo texture_info = {0};
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = overlay_format;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER;
+    texture_info.width = width;
+    texture_info.height = height;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+    overlay_texture = SDL_CreateGPUTexture(device, &texture_info);
+    if (!overlay_texture) {
+        return false;
+    }
+    if (overlay_depth_format != SDL_GPU_TEXTUREFORMAT_INVALID) {
+        texture_info.format = overlay_depth_format;
+        texture_info.usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET;
+        overlay_depth_texture = SDL_CreateGPUTexture(device, &texture_info);
+        if (!overlay_depth_texture) {
+            return false;
+        }
+    }
+    overlay_width = width;
+    overlay_height = height;
+    return true;
+}
+
+/* Writes the farthest depth of every block of the caller's depth texture
+ * into the depth of the overlay */
+static bool DownsampleDepth(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* depth_texture)
+{
+    if (!overlay_depth_pipeline || !overlay_depth_texture) {
+        return false;
+    }
+    SDL_GPUDepthStencilTargetInfo depth_info = {0};
+    depth_info.texture = overlay_depth_texture;
+    depth_info.load_op = SDL_GPU_LOADOP_DONT_CARE;
+    depth_info.store_op = SDL_GPU_STOREOP_STORE;
+    SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(command_buffer, NULL, 0, &depth_info);
+    if (!render_pass) {
+        return false;
+    }
+    SDL_BindGPUGraphicsPipeline(render_pass, overlay_depth_pipeline);
+    SDL_GPUTextureSamplerBinding binding = {0};
+    binding.texture = depth_texture;
+    binding.sampler = overlay_depth_sampler;
+    SDL_BindGPUFragmentSamplers(render_pass, 0, &binding, 1);
+    const Sint32 scale = overlay_scale;
+    SDL_PushGPUFragmentUniformData(command_buffer, 0, &scale, sizeof(scale));
+    SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
+    SDL_EndGPURenderPass(render_pass);
+    return true;
+}
+
+/* Blends the overlay over the color texture with linear filtering */
+static void CompositeOverlay(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture)
+{
+    SDL_GPUColorTargetInfo color_info = {0};
+    color_info.texture = color_texture;
+    color_info.load_op = SDL_GPU_LOADOP_LOAD;
+    color_info.store_op = SDL_GPU_STOREOP_STORE;
+    SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(command_buffer, &color_info, 1, NULL);
+    if (!render_pass) {
+        return;
+    }
+    SDL_BindGPUGraphicsPipeline(render_pass, composite_pipeline);
+    SDL_GPUTextureSamplerBinding binding = {0};
+    binding.texture = overlay_texture;
+    binding.sampler = overlay_sampler;
+    SDL_BindGPUFragmentSamplers(render_pass, 0, &binding, 1);
+    const float viewport[2] = {(float) viewport_width, (float) viewport_height};
+    SDL_PushGPUFragmentUniformData(command_buffer, 0, viewport, sizeof(viewport));
+    SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
+    SDL_EndGPURenderPass(render_pass);
+}
+
+/* The blend targets match the color target, which is the overlay or has the
+ * size of the viewport */
+static bool UpdateBlendTargets()
+{
+    if (!translucent_3d_pipeline) {
+        return SDL_SetError("Missing blended translucency shader build, rerun build_shaders.sh");
+    }
+    Uint32 width = viewport_width;
+    Uint32 height = viewport_height;
+    if (overlay_scale > 1) {
+        width = overlay_width;
+        height = overlay_height;
+    }
+    if (!width || !height) {
+        return SDL_SetError("Blended translucency needs SDL_SetGPUDViewport");
+    }
+    if (accum_texture && blend_width == width && blend_height == height) {
+        return true;
+    }
+    SDL_ReleaseGPUTexture(device, accum_texture);
+    SDL_ReleaseGPUTexture(device, reveal_texture);
+    accum_texture = NULL;
+    reveal_texture = NULL;
+    blend_width = 0;
+    blend_height = 0;
+    SDL_GPUTextureCreateInfo texture_info = {0};
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER;
+    texture_info.width = width;
+    texture_info.height = height;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+    accum_texture = SDL_CreateGPUTexture(device, &texture_info);
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R16_FLOAT;
+    reveal_texture = SDL_CreateGPUTexture(device, &texture_info);
+    if (!accum_texture || !reveal_texture) {
+        return false;
+    }
+    blend_width = width;
+    blend_height = height;
+    return true;
+}
+
+static void UploadCommands(
+    SDL_GPUCopyPass* copy_pass,
+    Command* commands)
+{
+    for (Command* command = commands; command; command = command->next) {
+        if (!command->transfer_buffer) {
+            dropped_bytes += command->size;
+            continue;
+        }
+        if (command->pooled) {
+            command->buffer = pool_buffer;
+        } else {
+            SDL_GPUBufferCreateInfo buffer_info = {0};
+            buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+            buffer_info.size = command->size;
+            command->buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+        }
+        if (!command->buffer) {
+            dropped_bytes += command->size;
+            continue;
+        }
+        SDL_GPUTransferBufferLocation location = {0};
+        SDL_GPUBufferRegion region = {0};
+        location.transfer_buffer = command->transfer_buffer;
+        location.offset = command->offset;
+        region.buffer = command->buffer;
+        region.offset = command->offset;
+        region.size = command->size;
+        SDL_UploadToGPUBuffer(copy_pass, &location, &region, false);
+    }
+}
+
+/* With a budget the upload is submitted on its own to learn when its slots
+ * can be written again, the draws reading them are submitted after it. Waits
+ * when every fence is taken */
+static bool UploadFrame(
+    SDL_GPUCommandBuffer* command_buffer)
+{
+    SDL_GPUCommandBuffer* upload_buffer = command_buffer;
+    if (budget) {
+        upload_buffer = SDL_AcquireGPUCommandBuffer(device);
+        if (!upload_buffer) {
+            return false;
+        }
+    }
+    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(upload_buffer);
+    if (!copy_pass) {
+        if (budget) {
+            SDL_CancelGPUCommandBuffer(upload_buffer);
+        }
+        return false;
+    }
+    UploadCommands(copy_pass, head);
+    SDL_EndGPUCopyPass(copy_pass);
+    if (!budget) {
+        return true;
+    }
+    PoolFence* entry = NULL;
+    while (!entry) {
+        SDL_GPUFence* fences[POOL_FENCES];
+        for (int i = 0; i < POOL_FENCES; i++) {
+            fences[i] = pool_fences[i].fence;
+            if (!fences[i]) {
+                entry = &pool_fences[i];
+                break;
+            }
+        }
+        if (!entry) {
+            SDL_WaitForGPUFences(device, false, fences, POOL_FENCES);
+            ReclaimPool();
+        }
+    }
+    entry->fence = SDL_SubmitGPUCommandBufferAndAcquireFence(upload_buffer);
+    if (!entry->fence) {
+        return false;
+    }
+    pool_fence = entry;
+    return true;
+}
+
+static void UploadTrails(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUCopyPass** copy_pass,
+    SDL_GPUDTrails* trails)
+{
+    const Uint32 count = SDL_min(trails->written - trails->uploaded, trails->length);
+    if (!count) {
+        return;
+    }
+    const Uint32 size = trails->num_trails * sizeof(SDL_GPUDVertex);
+    Uint8* data = SDL_MapGPUTransferBuffer(device, trails->transfer_buffer, true);
+    if (!data) {
+        return;
+    }
+    const Uint32 start = (trails->written - count) % trails->length;
+    const Uint32 runs[2][2] = {
+        {start, SDL_min(count, trails->length - start)},
+        {0, count - SDL_min(count, trails->length - start)},
+    };
+    Uint32 offset = 0;
+    for (int i = 0; i < 2 && runs[i][1]; i++) {
+        SDL_memcpy(data + offset * size, &trails->positions[runs[i][0] * trails->num_trails], runs[i][1] * size);
+        offset += runs[i][1];
+    }
+    SDL_UnmapGPUTransferBuffer(device, trails->transfer_buffer);
+    if (!*copy_pass) {
+        *copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    }
+    if (!*copy_pass) {
+        return;
+    }
+    offset = 0;
+    for (int i = 0; i < 2 && runs[i][1]; i++) {
+        SDL_GPUTransferBufferLocation location = {0};
+        SDL_GPUBufferRegion region = {0};
+        location.transfer_buffer = trails->transfer_buffer;
+        location.offset = offset * size;
+        region.buffer = trails->cloud.buffer;
+        region.offset = runs[i][0] * size;
+        region.size = runs[i][1] * size;
+        SDL_UploadToGPUBuffer(*copy_pass, &location, &region, false);
+        offset += runs[i][1];
+    }
+    trails->uploaded = trails->written;
+}
+
+static void UploadGraph(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUCopyPass** copy_pass,
+    SDL_GPUDGraph* graph)
+{
+    const Uint32 count = SDL_min(graph->written - graph->uploaded, graph->capacity);
+    if (!count) {
+        return;
+    }
+    float* values = SDL_MapGPUTransferBuffer(device, graph->transfer_buffer, true);
+    if (!values) {
+        return;
+    }
+    /* At most two runs when the new values wrap */
+    const Uint32 start = (graph->written - count) % graph->capacity;
+    const Uint32 runs[2][2] = {
+        {start, SDL_min(count, graph->capacity - start)},
+        {0, count - SDL_min(count, graph->capacity - start)},
+    };
+    Uint32 offset = 0;
+    for (int i = 0; i < 2 && runs[i][1]; i++) {
+        SDL_memcpy(values + offset, &graph->values[runs[i][0]], runs[i][1] * sizeof(float));
+        offset += runs[i][1];
+    }
+    SDL_UnmapGPUTransferBuffer(device, graph->transfer_buffer);
+    if (!*copy_pass) {
+        *copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    }
+    if (!*copy_pass) {
+        return;
+    }
+    offset = 0;
+    for (int i = 0; i < 2 && runs[i][1]; i++) {
+        SDL_GPUTransferBufferLocation location = {0};
+        SDL_GPUBufferRegion region = {0};
+        location.transfer_buffer = graph->transfer_buffer;
+        location.offset = offset * sizeof(float);
+        region.buffer = graph->cloud.buffer;
+        region.offset = runs[i][0] * sizeof(float);
+        region.size = runs[i][1] * sizeof(float);
+        SDL_UploadToGPUBuffer(*copy_pass, &location, &region, false);
+        offset += runs[i][1];
+    }
+    graph->uploaded = graph->written;
+}
+
+static void UploadCloudColors(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUCopyPass** copy_pass)
+{
+    if (num_cloud_draws > cloud_color_capacity) {
+        SDL_ReleaseGPUBuffer(device, cloud_colors);
+        SDL_ReleaseGPUTransferBuffer(device, cloud_color_transfer);
+        cloud_color_capacity = SDL_max(64, cloud_color_capacity * 2);
+        while (cloud_color_capacity < num_cloud_draws) {
+            cloud_color_capacity *= 2;
+        }
+        SDL_GPUBufferCreateInfo buffer_info = {0};
+        buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+        buffer_info.size = cloud_color_capacity * sizeof(Uint32);
+        cloud_colors = SDL_CreateGPUBuffer(device, &buffer_info);
+        SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+        transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transfer_buffer_info.size = buffer_info.size;
+        cloud_color_transfer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+        if (!cloud_colors || !cloud_color_transfer) {
+            SDL_ReleaseGPUBuffer(device, cloud_colors);
+            SDL_ReleaseGPUTransferBuffer(device, cloud_color_transfer);
+            cloud_colors = NULL;
+            cloud_color_transfer = NULL;
+            cloud_color_capacity = 0;
+            return;
+        }
+    }
+    Uint32* colors = SDL_MapGPUTransferBuffer(device, cloud_color_transfer, true);
+    if (!colors) {
+        return;
+    }
+    for (int i = 0; i < num_cloud_draws; i++) {
+        colors[i] = cloud_draws[i].color;
+    }
+    SDL_UnmapGPUTransferBuffer(device, cloud_color_transfer);
+    if (!*copy_pass) {
+        *copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    }
+    if (!*copy_pass) {
+        return;
+    }
+    SDL_GPUTransferBufferLocation location = {0};
+    SDL_GPUBufferRegion region = {0};
+    location.transfer_buffer = cloud_color_transfer;
+    region.buffer = cloud_colors;
+    region.size = num_cloud_draws * sizeof(Uint32);
+    SDL_UploadToGPUBuffer(*copy_pass, &location, &region, true);
+}
+
+static void UploadClouds(
+    SDL_GPUCommandBuffer* command_buffer)
+{
+    SDL_GPUCopyPass* copy_pass = NULL;
+    bool meshes = false;
+    for (int i = 0; i < num_cloud_draws; i++) {
+        meshes |= cloud_draws[i].cloud->type == CLOUD_TYPE_MESH;
+    }
+    if (meshes) {
+        UploadCloudColors(command_buffer, &copy_pass);
+    }
+    for (int i = 0; i < num_cloud_draws; i++) {
+        SDL_GPUDPointCloud* cloud = cloud_draws[i].cloud;
+        if (cloud->type == CLOUD_TYPE_GRAPH) {
+            UploadGraph(command_buffer, &copy_pass, (SDL_GPUDGraph*) cloud);
+            continue;
+        }
+        if (cloud->type == CLOUD_TYPE_TRAILS) {
+            UploadTrails(command_buffer, &copy_pass, (SDL_GPUDTrails*) cloud);
+            continue;
+        }
+    }
+    if (copy_pass) {
+        SDL_EndGPUCopyPass(copy_pass);
+    }
+}
+
+static bool ReserveShapeBuffer(
+    SDL_GPUBuffer** buffer,
+    Uint32* capacity,
+    const Uint32 size,
+    const SDL_GPUBufferUsageFlags usage)
+{
+    if (size <= *capacity) {
+        return true;
+    }
+    SDL_ReleaseGPUBuffer(device, *buffer);
+    *capacity = SDL_max(4096, *capacity * 2);
+    while (*capacity < size) {
+        *capacity *= 2;
+    }
+    SDL_GPUBufferCreateInfo buffer_info = {0};
+    buffer_info.usage = usage;
+    buffer_info.size = *capacity;
+    *buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+    if (!*buffer) {
+        *capacity = 0;
+        return false;
+    }
+    return true;
+}
+
+/* Uploads the packed arcs and the transforms and expands them with one
+ * invocation per arc. Every arc reserves its vertices in the range of its
+ * slot with an atomic add on the vertex count of the slot's indirect draw */
+static void ExpandShapes(
+    SDL_GPUCommandBuffer* command_buffer)
+{
+    if (!num_shape_arcs) {
+        return;
+    }
+    const Uint32 draw_size = 3 * sizeof(SDL_GPUIndirectDrawCommand);
+    const Uint32 arc_size = num_shape_arcs * sizeof(ShapeArc);
+    const Uint32 transform_size = num_transforms * sizeof(Transform);
+    const Uint32 num_vertices = shape_vertices[0] + shape_vertices[1] + shape_vertices[2];
+    if (!ReserveShapeBuffer(&shape_arc_buffer, &shape_arc_size, arc_size,
+            SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ) ||
+        !ReserveShapeBuffer(&shape_transform_buffer, &shape_transform_size, transform_size,
+            SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ) ||
+        !ReserveShapeBuffer(&shape_vertex_buffer, &shape_vertex_size, num_vertices * sizeof(SDL_GPUDVertex),
+            SDL_GPU_BUFFERUSAGE_VERTEX | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE)) {
+        SDL_zeroa(shape_vertices);
+        return;
+    }
+    const Uint32 size = draw_size + arc_size + transform_size;
+    if (size > shape_transfer_size) {
+        SDL_ReleaseGPUTransferBuffer(device, shape_transfer_buffer);
+        shape_transfer_size = SDL_max(4096, shape_transfer_size * 2);
+        while (shape_transfer_size < size) {
+            shape_transfer_size *= 2;
+        }
+        SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+        transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transfer_buffer_info.size = shape_transfer_size;
+        shape_transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+        if (!shape_transfer_buffer) {
+            shape_transfer_size = 0;
+            SDL_zeroa(shape_vertices);
+            return;
+        }
+    }
+    Uint8* data = SDL_MapGPUTransferBuffer(device, shape_transfer_buffer, true);
+    if (!data) {
+        SDL_zeroa(shape_vertices);
+        return;
+    }
+    SDL_GPUIndirectDrawCommand* draws = (SDL_GPUIndirectDrawCommand*) data;
+    Uint32 first = 0;
+    for (int i = 0; i < 3; i++) {
+        draws[i].num_vertices = 0;
+        draws[i].num_instances = 1;
+        draws[i].first_vertex = first;
+        draws[i].first_instance = 0;
+        first += shape_vertices[i];
+    }
+    SDL_memcpy(data + draw_size, shape_arcs, arc_size);
+    Transform* matrices = (Transform*) (data + draw_size + arc_size);
+    /* Shapes without a transform index the identity */
+    if (num_transforms > 1) {
+        SDL_memcpy(matrices + 1, transforms + 1, transform_size - sizeof(Transform));
+    }
+    SDL_zero(matrices[0]);
+    for (int i = 0; i < 4; i++) {
+        matrices[0].matrix[i * 5] = 1.0f;
+    }
+    SDL_UnmapGPUTransferBuffer(device, shape_transfer_buffer);
+    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    if (!copy_pass) {
+        SDL_zeroa(shape_vertices);
+        return;
+    }
+    SDL_GPUTransferBufferLocation location = {0};
+    SDL_GPUBufferRegion region = {0};
+    location.transfer_buffer = shape_transfer_buffer;
+    region.buffer = shape_draw_buffer;
+    region.size = draw_size;
+    SDL_UploadToGPUBuffer(copy_pass, &location, &region, true);
+    location.offset = draw_size;
+    region.buffer = shape_arc_buffer;
+    region.size = arc_size;
+    SDL_UploadToGPUBuffer(copy_pass, &location, &region, true);
+    location.offset = draw_size + arc_size;
+    region.buffer = shape_transform_buffer;
+    region.size = transform_size;
+    SDL_UploadToGPUBuffer(copy_pass, &location, &region, true);
+    SDL_EndGPUCopyPass(copy_pass);
+    /* The draws were just uploaded, only the vertices are cycled */
+    SDL_GPUStorageBufferReadWriteBinding bindings[2] = {0};
+    bindings[0].buffer = shape_vertex_buffer;
+    bindings[0].cycle = true;
+    bindings[1].buffer = shape_draw_buffer;
+    SDL_GPUComputePass* compute_pass = SDL_BeginGPUComputePass(command_buffer, NULL, 0, bindings, 2);
+    if (!compute_pass) {
+        SDL_zeroa(shape_vertices);
+        return;
+    }
+    SDL_GPUBuffer* buffers[2] = {shape_arc_buffer, shape_transform_buffer};
+    const Uint32 count = num_shape_arcs;
+    SDL_BindGPUComputePipeline(compute_pass, shape_pipeline);
+    SDL_BindGPUComputeStorageBuffers(compute_pass, 0, buffers, 2);
+    SDL_PushGPUComputeUniformData(command_buffer, 0, &count, sizeof(count));
+    SDL_DispatchGPUCompute(compute_pass, (count + 63) / 64, 1, 1);
+    SDL_EndGPUComputePass(compute_pass);
+}
+
+/* Accumulates the translucent batches into the blend targets and resolves
+ * them onto the color target in a new pass, returned for the screen slot */
+static SDL_GPURenderPass* DrawBlended(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUColorTargetInfo* color_info,
+    SDL_GPUDepthStencilTargetInfo* depth_info,
+    Command* commands,
+    const void* matrix)
+{
+    SDL_GPUColorTargetInfo blend_infos[2] = {0};
+    blend_infos[0].texture = accum_texture;
+    blend_infos[0].load_op = SDL_GPU_LOADOP_CLEAR;
+    blend_infos[0].store_op = SDL_GPU_STOREOP_STORE;
+    blend_infos[1].texture = reveal_texture;
+    blend_infos[1].load_op = SDL_GPU_LOADOP_CLEAR;
+    blend_infos[1].store_op = SDL_GPU_STOREOP_STORE;
+    blend_infos[1].clear_color = (SDL_FColor) {1.0f, 1.0f, 1.0f, 1.0f};
+    color_info->load_op = SDL_GPU_LOADOP_LOAD;
+    if (depth_info) {
+        depth_info->load_op = SDL_GPU_LOADOP_LOAD;
+    }
+    SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(command_buffer, blend_infos, 2, depth_info);
+    if (!render_pass) {
+        return NULL;
+    }
+    DrawCommands(command_buffer, render_pass, commands, depth_info != NULL, matrix, 1, 1, true);
+    SDL_EndGPURenderPass(render_pass);
+    render_pass = SDL_BeginGPURenderPass(command_buffer, color_info, 1, depth_info);
+    if (!render_pass) {
+        return NULL;
+    }
+    SDL_BindGPUGraphicsPipeline(render_pass, depth_info ? resolve_3d_pipeline : resolve_2d_pipeline);
+    SDL_GPUTextureSamplerBinding bindings[2] = {0};
+    bindings[0].texture = accum_texture;
+    bindings[0].sampler = blend_sampler;
+    bindings[1].texture = reveal_texture;
+    bindings[1].sampler = blend_sampler;
+    SDL_BindGPUFragmentSamplers(render_pass, 0, bindings, 2);
+    SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
+    return render_pass;
+}
+
+static bool DrawFrame(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture,
+    SDL_GPUTexture* depth_texture,
+    Command* commands,
+    const void* matrix)
+{
+    SDL_GPUColorTargetInfo color_info = {0};
+    color_info.texture = color_texture;
+    color_info.load_op = SDL_GPU_LOADOP_LOAD;
+    color_info.store_op = SDL_GPU_STOREOP_STORE;
+    SDL_GPUDepthStencilTargetInfo depth_info = {0};
+    depth_info.texture = depth_texture;
+    depth_info.load_op = SDL_GPU_LOADOP_LOAD;
+    depth_info.store_op = SDL_GPU_STOREOP_STORE;
+    /* The overlay is cleared by every submit and starts with the caller's
+     * depth reduced to its own size */
+    if (overlay_scale > 1) {
+        if (!UpdateOverlay()) {
+            return false;
+        }
+        color_info.texture = overlay_texture;
+        color_info.load_op = SDL_GPU_LOADOP_CLEAR;
+        if (depth_texture && !DownsampleDepth(command_buffer, depth_texture)) {
+            depth_info.load_op = SDL_GPU_LOADOP_CLEAR;
+            depth_info.clear_depth = 1.0f;
+        }
+        depth_info.texture = depth_texture ? overlay_depth_texture : NULL;
+        depth_texture = depth_info.texture;
+    }
+    UploadClouds(command_buffer);
+    ExpandShapes(command_buffer);
+    bool blended = false;
+    for (Command* command = commands; command; command = command->next) {
+        blended |= command->buffer && command->type == COMMAND_TYPE_TRANSLUCENT;
+    }
+    if (blended) {
+        blended = UpdateBlendTargets();
+    }
+    SDL_GPUDepthStencilTargetInfo* depth_target = depth_texture ? &depth_info : NULL;
+    SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(command_buffer, &color_info, 1, depth_target);
+    if (render_pass && blended) {
+        DrawCommands(command_buffer, render_pass, commands, depth_target != NULL, matrix, 0, 0, true);
+        SDL_EndGPURenderPass(render_pass);
+        render_pass = DrawBlended(command_buffer, &color_info, depth_target, commands, matrix);
+        if (render_pass) {
+            DrawCommands(command_buffer, render_pass, commands, depth_target != NULL, matrix, 2, 2, true);
+        }
+    } else if (render_pass) {
+        DrawCommands(command_buffer, render_pass, commands, depth_target != NULL, matrix, 0, 2, false);
+    }
+    if (render_pass) {
+        SDL_EndGPURenderPass(render_pass);
+    }
+    if (overlay_scale > 1) {
+        CompositeOverlay(command_buffer, color_texture);
+    }
+    if (append_buffer) {
+        ResetAppendBuffer(command_buffer);
+    }
+    return true;
+}
+
+static void SwapCloudDraws()
+{
+    CloudDraw* draws = cloud_draws;
+    cloud_draws = sealed.cloud_draws;
+    sealed.cloud_draws = draws;
+    const int count = num_cloud_draws;
+    num_cloud_draws = sealed.num_cloud_draws;
+    sealed.num_cloud_draws = count;
+    const int capacity = cloud_draw_capacity;
+    cloud_draw_capacity = sealed.cloud_draw_capacity;
+    sealed.cloud_draw_capacity = capacity;
+}
+
+/* Exchanges the state DrawCommands reads with the sealed frame */
+static void SwapSealed()
+{
+    Transform* data = transforms;
+    transforms = sealed.transforms;
+    sealed.transforms = data;
+    const int capacity = transform_capacity;
+    transform_capacity = sealed.transform_capacity;
+    sealed.transform_capacity = capacity;
+    SwapCloudDraws();
+    float matrix[16];
+    SDL_memcpy(matrix, custom_matrix, sizeof(matrix));
+    SDL_memcpy(custom_matrix, sealed.custom, sizeof(matrix));
+    SDL_memcpy(sealed.custom, matrix, sizeof(matrix));
+    const Uint32 width = viewport_width;
+    const Uint32 height = viewport_height;
+    viewport_width = sealed.viewport[0];
+    viewport_height = sealed.viewport[1];
+    sealed.viewport[0] = width;
+    sealed.viewport[1] = height;
+}
+
+/* Waits for the worker and draws the frame sealed by the previous submit */
+static void SubmitSealed(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture,
+    SDL_GPUTexture* depth_texture)
+{
+    if (!sealed.pending) {
+        /* Nothing was drawn into the append buffer without a frame */
+        if (append_buffer) {
+            ResetAppendBuffer(command_buffer);
+        }
+        return;
+    }
+    SDL_WaitSemaphore(pack_done);
+    sealed.pending = false;
+    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    if (copy_pass) {
+        UploadCommands(copy_pass, sealed.head);
+        SDL_EndGPUCopyPass(copy_pass);
+        SwapSealed();
+        DrawFrame(command_buffer, color_texture, depth_texture, sealed.head, sealed.matrix);
+        SwapSealed();
+    }
+    for (Command* command = sealed.head; command; command = command->next) {
+        ReleaseCommand(command);
+    }
+    sealed.head = NULL;
+}
+
+/* Hands the recorded frame to the worker and starts recording into the
+ * commands and transforms of the frame that was just drawn. Labels, impostors
+ * and translucent points are expanded with the matrix the frame is sealed
+ * with, which is also the one it is drawn with. The frame is only drawn by
+ * the next submit, so threaded mode shows the primitives one submit late */
+static void Seal(
+    const void* matrix,
+    const bool depth)
+{
+    PushDeferred(matrix);
+    if (capture) {
+        WriteCapture(matrix, depth);
+    }
+    SDL_memcpy(sealed.matrix, matrix, sizeof(sealed.matrix));
+    SDL_memcpy(sealed.custom, custom_matrix, sizeof(sealed.custom));
+    sealed.viewport[0] = viewport_width;
+    sealed.viewport[1] = viewport_height;
+    sealed.head = head;
+    CommandBlock* blocks = sealed.arena;
+    sealed.arena = arena_head;
+    arena_head = blocks;
+    Transform* data = transforms;
+    transforms = sealed.transforms;
+    sealed.transforms = data;
+    const int capacity = transform_capacity;
+    transform_capacity = sealed.transform_capacity;
+    sealed.transform_capacity = capacity;
+    SwapCloudDraws();
+    ResetFrame();
+    /* Clouds and the append buffer are drawn even without any batches */
+    if (sealed.head || sealed.num_cloud_draws || append_buffer) {
+        sealed.pending = true;
+        SDL_SignalSemaphore(pack_start);
+    }
+}
+
+void SDL_SubmitGPUD(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture,
+    SDL_GPUTexture* depth_texture,
+    const void* matrix)
+{
+    if (!device) {
+        return;
+    }
+    if (!command_buffer) {
+        SDL_InvalidParamError("command_buffer");
+        return;
+    }
+    if (!color_texture) {
+        SDL_InvalidParamError("color_texture");
+        return;
+    }
+    if (!matrix) {
+        SDL_InvalidParamError("matrix");
+        return;
+    }
+    if (threaded) {
+        SubmitSealed(command_buffer, color_texture, depth_texture);
+        Seal(matrix, depth_texture != NULL);
+        return;
+    }
+    /* Captures and budgets need the lines as batches */
+    if (shape_pipeline && !capture && !budget) {
+        PackShapes();
+    }
+    PushDeferred(matrix);
+    if (capture) {
+        WriteCapture(matrix, depth_texture != NULL);
+    }
+    UnmapCommands();
+    /* Pooled batches share their buffers and are never cached */
+    const bool cache = frame_cache && !budget && head;
+    CachedFrame* cached_frame = NULL;
+    if (cache) {
+        cached_frame = FindCachedFrame();
+    }
+    if (!cached_frame && !UploadFrame(command_buffer)) {
+        ReleaseCommands();
+        return;
+    }
+    if (!DrawFrame(command_buffer, color_texture, depth_texture, cached_frame ? cached_frame->head : head, matrix)) {
+        ReleaseCommands();
+        return;
+    }
+    if (cache && !cached_frame) {
+        CacheFrame();
+    }
+    ReleaseCommands();
+}
+
+void SDL_SubmitGPUD2D(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture,
+    const Uint32 width,
+    const Uint32 height)
+{
+    if (!device) {
+        return;
+    }
+    if (!width) {
+        SDL_InvalidParamError("width");
+        return;
+    }
+    if (!height) {
+        SDL_InvalidParamError("height");
+        return;
+    }
+    float matrix[16];
+    GetScreenMatrix(matrix, width, height);
+    SDL_SetGPUDViewport(width, height);
+    SDL_SubmitGPUD(command_buffer, color_texture, NULL, matrix);
+}
+
+SDL_GPUTexture* SDL_GetGPUDOverlay(
+    Uint32* width,
+    Uint32* height)
+{
+    if (width) {
+        *width = overlay_width;
+    }
+    if (height) {
+        *height = overlay_height;
+    }
+    return overlay_texture;
+}
+
+SDL_GPUBuffer* SDL_GetGPUDAppendBuffer(
+    SDL_GPUBuffer** counter)
+{
+    if (counter) {
+        *counter = append_counter;
+    }
+    return append_buffer;
+}
+
+bool SDL_BeginGPUDCapture(
+    const char* path)
+{
+    if (!path) {
+        return SDL_InvalidParamError("path");
+    }
+    SDL_EndGPUDCapture();
+    capture = SDL_IOFromFile(path, "wb");
+    if (!capture) {
+        return false;
+    }
+    CaptureHeader header = {CAPTURE_MAGIC, CAPTURE_VERSION};
+    if (SDL_WriteIO(capture, &header, sizeof(header)) != sizeof(header)) {
+        SDL_EndGPUDCapture();
+        return false;
+    }
+    return true;
+}
+
+void SDL_EndGPUDCapture()
+{
+    if (capture) {
+        SDL_CloseIO(capture);
+        capture = NULL;
+    }
+}
+
+static bool MapReplay(
+    SDL_GPUDReplay* replay,
+    const char* path)
+{
+#if defined(SDL_PLATFORM_WINDOWS)
+    replay->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (replay->file == INVALID_HANDLE_VALUE) {
+        return SDL_SetError("Failed to open %s", path);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(replay->file, &size) || !size.QuadPart) {
+        CloseHandle(replay->file);
+        return SDL_SetError("Failed to get size of %s", path);
+    }
+    replay->mapping = CreateFileMappingA(replay->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!replay->mapping) {
+        CloseHandle(replay->file);
+        return SDL_SetError("Failed to map %s", path);
+    }
+    replay->data = MapViewOfFile(replay->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!replay->data) {
+        CloseHandle(replay->mapping);
+        CloseHandle(replay->file);
+        return SDL_SetError("Failed to map %s", path);
+    }
+    replay->size = size.QuadPart;
+    return true;
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+    const int file = open(path, O_RDONLY);
+    if (file < 0) {
+        return SDL_SetError("Failed to open %s", path);
+    }
+    struct stat info;
+    if (fstat(file, &info) || !info.st_size) {
+        close(file);
+        return SDL_SetError("Failed to get size of %s", path);
+    }
+    void* data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED) {
+        return SDL_SetError("Failed to map %s", path);
+    }
+    replay->data = data;
+    replay->size = info.st_size;
+    return true;
+#else
+    replay->data = SDL_LoadFile(path, &replay->size);
+    return replay->data != NULL;
+#endif
+}
+
+static void UnmapReplay(
+    SDL_GPUDReplay* replay)
+{
+#if defined(SDL_PLATFORM_WINDOWS)
+    UnmapViewOfFile(replay->data);
+    CloseHandle(replay->mapping);
+    CloseHandle(replay->file);
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+    munmap((void*) replay->data, replay->size);
+#else
+    SDL_free((void*) replay->data); /* SDL_LoadFile */
+#endif
+}
+
+SDL_GPUDReplay* SDL_OpenGPUDReplay(
+    const char* path)
+{
+    if (!path) {
+        SDL_InvalidParamError("path");
+        return NULL;
     }
-    device = handle;
+    SDL_GPUDReplay* replay = Calloc(1, sizeof(SDL_GPUDReplay));
+    if (!replay) {
+        return NULL;
+    }
+    if (!MapReplay(replay, path)) {
+        Free(replay);
+        return NULL;
+    }
+    const CaptureHeader* header = (const CaptureHeader*) replay->data;
+    if (replay->size < sizeof(CaptureHeader) ||
+        header->magic != CAPTURE_MAGIC ||
+        header->version != CAPTURE_VERSION) {
+        SDL_SetError("Invalid capture file %s", path);
+        SDL_CloseGPUDReplay(replay);
+        return NULL;
+    }
+    /* Only the frame headers are visited, the commands are skipped over */
+    int capacity = 0;
+    size_t offset = sizeof(CaptureHeader);
+    while (offset + sizeof(CaptureFrame) <= replay->size) {
+        const CaptureFrame* frame = (const CaptureFrame*) (replay->data + offset);
+        if (frame->size < sizeof(CaptureFrame) - sizeof(frame->size) ||
+            frame->size % sizeof(Uint32) ||
+            offset + sizeof(frame->size) + frame->size > replay->size) {
+            break;
+        }
+        if (replay->num_frames == capacity) {
+            capacity = SDL_max(64, capacity * 2);
+            const CaptureFrame** frames = Realloc(replay->frames, capacity * sizeof(CaptureFrame*));
+            if (!frames) {
+                SDL_CloseGPUDReplay(replay);
+                return NULL;
+            }
+            replay->frames = frames;
+        }
+        replay->frames[replay->num_frames++] = frame;
+        offset += sizeof(frame->size) + frame->size;
+    }
+    return replay;
+}
+
+void SDL_CloseGPUDReplay(
+    SDL_GPUDReplay* replay)
+{
+    if (!replay) {
+        return;
+    }
+    UnmapReplay(replay);
+    Free(replay->frames);
+    Free(replay);
+}
+
+int SDL_GetGPUDReplayFrames(
+    const SDL_GPUDReplay* replay)
+{
+    if (!replay) {
+        SDL_InvalidParamError("replay");
+        return 0;
+    }
+    return replay->num_frames;
+}
+
+/* Captured and streamed commands come from outside of the process, so their
+ * type, slot and size are checked before any of them is pushed */
+static bool CheckCaptured(
+    const CaptureCommand* command,
+    const Uint32 available)
+{
+    const Uint32 type = command->type & CAPTURE_TYPE_MASK;
+    if (type > COMMAND_TYPE_GLYPH_OCCLUDED || command->type >> CAPTURE_SLOT_SHIFT > SDL_GPUD_SLOT_CUSTOM) {
+        return SDL_SetError("Invalid captured command type %u", command->type);
+    }
+    if (command->size % GetPrimitiveSize(type) || command->size > available) {
+        return SDL_SetError("Invalid captured command size %u", command->size);
+    }
+    return true;
+}
+
+/* Pushes a captured command into the slot it was recorded in */
+static void PushCaptured(
+    const CaptureCommand* command,
+    void* data)
+{
+    const SDL_GPUDSlot previous = slot;
+    slot = command->type >> CAPTURE_SLOT_SHIFT;
+    PushBaked(command->type & CAPTURE_TYPE_MASK, data, command->size);
+    slot = previous;
+}
+
+/* Sets the matrices the slots of a captured frame are drawn with until the
+ * frame was submitted */
+static void ApplyCaptured(
+    const CaptureFrame* frame)
+{
+    if (!restore_pending) {
+        SDL_memcpy(restore_custom, custom_matrix, sizeof(restore_custom));
+        restore_viewport[0] = viewport_width;
+        restore_viewport[1] = viewport_height;
+        restore_pending = true;
+    }
+    SDL_memcpy(custom_matrix, frame->custom, sizeof(custom_matrix));
+    viewport_width = frame->viewport[0];
+    viewport_height = frame->viewport[1];
+}
+
+bool SDL_ReplayGPUD(
+    const SDL_GPUDReplay* replay,
+    const int frame,
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPUTexture* color_texture,
+    SDL_GPUTexture* depth_texture)
+{
     if (!device) {
-        return SDL_InvalidParamError("device");
+        return false;
+    }
+    if (!replay) {
+        return SDL_InvalidParamError("replay");
+    }
+    if (frame < 0 || frame >= replay->num_frames) {
+        return SDL_InvalidParamError("frame");
+    }
+    const CaptureFrame* header = replay->frames[frame];
+    const Uint8* end = (const Uint8*) header + sizeof(header->size) + header->size;
+    const Uint8* data = (const Uint8*) (header + 1);
+    for (Uint32 i = 0; i < header->num_commands; i++) {
+        const CaptureCommand* command = (const CaptureCommand*) data;
+        if ((Uint32) (end - data) < sizeof(CaptureCommand)) {
+            return SDL_SetError("Invalid captured frame %d", frame);
+        }
+        if (!CheckCaptured(command, end - data - sizeof(CaptureCommand))) {
+            return false;
+        }
+        data += sizeof(CaptureCommand) + command->size;
+    }
+    ApplyCaptured(header);
+    data = (const Uint8*) (header + 1);
+    for (Uint32 i = 0; i < header->num_commands; i++) {
+        const CaptureCommand* command = (const CaptureCommand*) data;
+        PushCaptured(command, (void*) (command + 1));
+        data += sizeof(CaptureCommand) + command->size;
+    }
+    if (!(header->flags & CAPTURE_FLAG_DEPTH)) {
+        depth_texture = NULL;
+    }
+    SDL_SubmitGPUD(command_buffer, color_texture, depth_texture, header->matrix);
+    return true;
+}
+
+bool SDL_BeginGPUDStream(
+    SDL_IOStream* handle)
+{
+    if (!handle) {
+        return SDL_InvalidParamError("stream");
     }
-    SDL_GPUShaderCreateInfo fragment_shader_info = {0};
-    SDL_GPUShaderCreateInfo vertex_shader_info = {0};
-    if (SDL_GetGPUShaderFormats(device) & SDL_GPU_SHADERFORMAT_SPIRV) {
-        fragment_shader_info.code = shader_frag_spv;
-        vertex_shader_info.code = shader_vert_spv;
-        fragment_shader_info.code_size = shader_frag_spv_len;
-        vertex_shader_info.code_size = shader_vert_spv_len;
-        fragment_shader_info.entrypoint = "main";
-        vertex_shader_info.entrypoint = "main";
-        fragment_shader_info.format = SDL_GPU_SHADERFORMAT_SPIRV;
-        vertex_shader_info.format = SDL_GPU_SHADERFORMAT_SPIRV;
-    } else if (SDL_GetGPUShaderFormats(device) & SDL_GPU_SHADERFORMAT_DXIL) {
-        fragment_shader_info.code = shader_frag_dxil;
-        vertex_shader_info.code = shader_vert_dxil;
-        fragment_shader_info.code_size = shader_frag_dxil_len;
-        vertex_shader_info.code_size = shader_vert_dxil_len;
-        fragment_shader_info.entrypoint = "main";
-        vertex_shader_info.entrypoint = "main";
-        fragment_shader_info.format = SDL_GPU_SHADERFORMAT_DXIL;
-        vertex_shader_info.format = SDL_GPU_SHADERFORMAT_DXIL;
-    } else if (SDL_GetGPUShaderFormats(device) & SDL_GPU_SHADERFORMAT_MSL) {
-        fragment_shader_info.code = shader_frag_msl;
-        vertex_shader_info.code = shader_vert_msl;
-        fragment_shader_info.code_size = shader_frag_msl_len;
-        vertex_shader_info.code_size = shader_vert_msl_len;
-        fragment_shader_info.entrypoint = "main0";
-        vertex_shader_info.entrypoint = "main0";
-        fragment_shader_info.format = SDL_GPU_SHADERFORMAT_MSL;
-        vertex_shader_info.format = SDL_GPU_SHADERFORMAT_MSL;
+    SDL_EndGPUDStream();
+    stream = handle;
+    return true;
+}
+
+void SDL_EndGPUDStream()
+{
+    stream = NULL;
+    Free(stream_send.words);
+    Free(stream_scratch.words);
+    SDL_zero(stream_send);
+    SDL_zero(stream_scratch);
+}
+
+void SDL_StreamGPUD(
+    const void* matrix,
+    const bool depth)
+{
+    if (!device) {
+        return;
+    }
+    if (!matrix) {
+        SDL_InvalidParamError("matrix");
+        return;
+    }
+    PushDeferred(matrix);
+    if (stream) {
+        WriteStream(matrix, depth);
+    }
+    if (!threaded) {
+        UnmapCommands();
+    }
+    ReleaseCommands();
+}
+
+bool SDL_ReceiveGPUDStream(
+    SDL_IOStream* handle,
+    float* matrix,
+    bool* depth)
+{
+    if (!device) {
+        return false;
+    }
+    if (!handle) {
+        return SDL_InvalidParamError("stream");
+    }
+    CaptureFrame frame;
+    if (SDL_ReadIO(handle, &frame, sizeof(frame)) != sizeof(frame)) {
+        return false;
+    }
+    const Uint32 size = frame.size - (sizeof(CaptureFrame) - sizeof(frame.size));
+    if (size % sizeof(Uint32) || size < frame.num_commands * sizeof(CaptureCommand)) {
+        return SDL_SetError("Invalid stream");
+    }
+    stream_scratch.size = 0;
+    if (!ReserveStream(&stream_scratch, size / sizeof(Uint32))) {
+        return false;
+    }
+    if (SDL_ReadIO(handle, stream_scratch.words, size) != size) {
+        return false;
+    }
+    const CaptureCommand* commands = (const CaptureCommand*) stream_scratch.words;
+    const Uint32* tokens = (const Uint32*) (commands + frame.num_commands);
+    const Uint32* end = stream_scratch.words + size / sizeof(Uint32);
+    const bool keyframe = frame.flags & CAPTURE_FLAG_KEYFRAME;
+    if (!keyframe && frame.num_commands != stream_receive.num_commands) {
+        return SDL_SetError("Invalid stream");
+    }
+    /* A token covers at most one run of each kind, which bounds how many
+     * words the frame can decode to */
+    const Uint64 max_bytes = (Uint64) (end - tokens) * STREAM_MAX_RUN * 2 * sizeof(Uint32);
+    Uint64 num_bytes = 0;
+    for (Uint32 i = 0; i < frame.num_commands; i++) {
+        if (!CheckCaptured(&commands[i], SDL_min(max_bytes - num_bytes, UINT32_MAX))) {
+            return false;
+        }
+        num_bytes += commands[i].size;
+    }
+    /* The tokens of every batch are checked before any of them is applied, so
+     * that a rejected frame leaves the previous one to decode the next against */
+    const Uint32* token = tokens;
+    for (Uint32 i = 0; i < frame.num_commands; i++) {
+        const Uint32 num_words = commands[i].size / sizeof(Uint32);
+        for (Uint32 j = 0; j < num_words;) {
+            if (token >= end) {
+                return SDL_SetError("Invalid stream");
+            }
+            const Uint32 literals = *token & STREAM_MAX_RUN;
+            j += (*token >> 16) + literals;
+            if (j > num_words || literals >= (Uint32) (end - token)) {
+                return SDL_SetError("Invalid stream");
+            }
+            token += 1 + literals;
+        }
+    }
+    if (token != end) {
+        return SDL_SetError("Invalid stream");
+    }
+    const Uint32 num_headers = frame.num_commands * sizeof(CaptureCommand) / sizeof(Uint32);
+    const Uint32 num_words = num_bytes / sizeof(Uint32);
+    if (!ReserveStream(&stream_decode, num_headers + num_words)) {
+        return false;
+    }
+    SDL_memcpy(stream_decode.words, commands, frame.num_commands * sizeof(CaptureCommand));
+    stream_decode.size = num_headers + num_words;
+    stream_decode.num_commands = frame.num_commands;
+    const CaptureCommand* prev_commands = (const CaptureCommand*) stream_receive.words;
+    const Uint32* prev = stream_receive.words + num_headers;
+    Uint32* words = stream_decode.words + num_headers;
+    for (Uint32 i = 0; i < frame.num_commands; i++) {
+        const bool same = !keyframe && prev_commands[i].type == commands[i].type &&
+            prev_commands[i].size == commands[i].size;
+        const Uint32 num_words = commands[i].size / sizeof(Uint32);
+        for (Uint32 j = 0; j < num_words;) {
+            const Uint32 zeros = *tokens >> 16;
+            const Uint32 literals = *tokens & STREAM_MAX_RUN;
+            tokens++;
+            for (Uint32 k = 0; k < zeros; k++, j++) {
+                words[j] = same ? prev[j] : 0;
+            }
+            for (Uint32 k = 0; k < literals; k++, j++) {
+                words[j] = *tokens++ ^ (same ? prev[j] : 0);
+            }
+        }
+        words += num_words;
+        if (!keyframe) {
+            prev += prev_commands[i].size / sizeof(Uint32);
+        }
+    }
+    StreamBuffer swap = stream_receive;
+    stream_receive = stream_decode;
+    stream_decode = swap;
+    ApplyCaptured(&frame);
+    Uint8* data = (Uint8*) (stream_receive.words + num_headers);
+    for (Uint32 i = 0; i < frame.num_commands; i++) {
+        PushCaptured(&commands[i], data);
+        data += commands[i].size;
+    }
+    if (matrix) {
+        SDL_memcpy(matrix, frame.matrix, sizeof(frame.matrix));
+    }
+    if (depth) {
+        *depth = frame.flags & CAPTURE_FLAG_DEPTH;
+    }
+    return true;
+}
+
+static SDL_GPUDRing* MapRing(
+    const char* name,
+    Uint32 capacity)
+{
+    SDL_GPUDRing* ring = Calloc(1, sizeof(SDL_GPUDRing));
+    if (!ring) {
+        return NULL;
+    }
+    const bool create = capacity > 0;
+#if defined(SDL_PLATFORM_WINDOWS)
+    if (create) {
+        ring->size = sizeof(RingHeader) + capacity;
+        ring->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, (DWORD) ring->size, name);
     } else {
-        return SDL_Unsupported();
+        ring->mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
     }
-    fragment_shader_info.num_uniform_buffers = 0;
-    vertex_shader_info.num_uniform_buffers = 1;
-    fragment_shader_info.stage = SDL_GPU_SHADERSTAGE_FRAGMENT;
-    vertex_shader_info.stage = SDL_GPU_SHADERSTAGE_VERTEX;
-    SDL_GPUShader* fragment_shader = SDL_CreateGPUShader(device, &fragment_shader_info);
-    SDL_GPUShader* vertex_shader = SDL_CreateGPUShader(device, &vertex_shader_info);
-    if (!fragment_shader || !vertex_shader) {
-        goto error;
+    if (!ring->mapping) {
+        SDL_SetError("Failed to map %s", name);
+        Free(ring);
+        return NULL;
     }
-    SDL_GPUGraphicsPipelineCreateInfo pipeline_info = {
-        .vertex_shader = vertex_shader,
-        .fragment_shader = fragment_shader,
-        .target_info = {
-            .num_color_targets = 1,
-            .color_target_descriptions = (SDL_GPUColorTargetDescription[]) {{
-                .format = color_format,
-                .blend_state = {
-                    .enable_blend = true,
-                    .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
-                    .color_blend_op = SDL_GPU_BLENDOP_ADD,
-                    .src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
-                    .src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
-                    .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-                    .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-                },
-            }},
-            .depth_stencil_format = depth_format,
-        },
-        .vertex_input_state = {
-            .num_vertex_attributes = 2,
-            .vertex_attributes = (SDL_GPUVertexAttribute[]) {{
-                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
-                .location = 0,
-                .offset = 0,
-            }, {
-                .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
-                .location = 1,
-                .offset = 12,
-            }},
-            .num_vertex_buffers = 1,
-            .vertex_buffer_descriptions = (SDL_GPUVertexBufferDescription[]) {{
-                .pitch = 16,
-            }},
-        },
-        .depth_stencil_state = {
-            .compare_op = SDL_GPU_COMPAREOP_LESS,
-            .enable_depth_test = true,
-            .enable_depth_write = true,
+    ring->header = MapViewOfFile(ring->mapping, FILE_MAP_ALL_ACCESS, 0, 0, ring->size);
+    if (!ring->header) {
+        SDL_SetError("Failed to map %s", name);
+        CloseHandle(ring->mapping);
+        Free(ring);
+        return NULL;
+    }
+    if (!create) {
+        /* The view spans the whole mapping, whose size only the creator knows */
+        ring->size = sizeof(RingHeader) + ring->header->capacity;
+    }
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+    const int file = shm_open(name, create ? O_CREAT | O_EXCL | O_RDWR : O_RDWR, 0600);
+    if (file < 0) {
+        SDL_SetError("Failed to open %s", name);
+        Free(ring);
+        return NULL;
+    }
+    struct stat info;
+    if (create) {
+        ring->size = sizeof(RingHeader) + capacity;
+        if (ftruncate(file, ring->size)) {
+            SDL_SetError("Failed to resize %s", name);
+            close(file);
+            shm_unlink(name);
+            Free(ring);
+            return NULL;
         }
-    };
-    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST;
-    pipeline_info.target_info.has_depth_stencil_target = false;
-    line_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
-    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST;
-    pipeline_info.target_info.has_depth_stencil_target = true;
-    line_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
-    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
-    pipeline_info.target_info.has_depth_stencil_target = false;
-    poly_2d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
-    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
-    pipeline_info.target_info.has_depth_stencil_target = true;
-    poly_3d_pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
-    if (!line_2d_pipeline || !line_3d_pipeline || !poly_2d_pipeline || !poly_3d_pipeline) {
-        goto error;
+    } else if (!fstat(file, &info)) {
+        ring->size = info.st_size;
+    }
+    void* data = MAP_FAILED;
+    if (ring->size >= sizeof(RingHeader)) {
+        data = mmap(NULL, ring->size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    }
+    close(file);
+    if (data == MAP_FAILED) {
+        SDL_SetError("Failed to map %s", name);
+        if (create) {
+            shm_unlink(name);
+        }
+        Free(ring);
+        return NULL;
+    }
+    ring->header = data;
+#else
+    SDL_Unsupported();
+    Free(ring);
+    return NULL;
+#endif
+    ring->data = (Uint8*) (ring->header + 1);
+    if (create) {
+        ring->header->capacity = capacity;
+        SDL_SetAtomicU32(&ring->header->head, 0);
+        SDL_SetAtomicU32(&ring->header->tail, 0);
+        SDL_MemoryBarrierRelease();
+        ring->header->magic = RING_MAGIC;
+        const size_t length = SDL_strlen(name) + 1;
+        ring->name = Malloc(length);
+        if (ring->name) {
+            SDL_memcpy(ring->name, name, length);
+        }
+    } else if (ring->header->magic != RING_MAGIC || ring->header->capacity < sizeof(RingRecord) ||
+               ring->header->capacity & (ring->header->capacity - 1) ||
+               sizeof(RingHeader) + ring->header->capacity > ring->size) {
+        SDL_SetError("Invalid ring %s", name);
+        SDL_CloseGPUDRing(ring);
+        return NULL;
+    }
+    ring->capacity = ring->header->capacity;
+    return ring;
+}
+
+SDL_GPUDRing* SDL_CreateGPUDRing(
+    const char* name,
+    const Uint32 capacity)
+{
+    if (!name) {
+        SDL_InvalidParamError("name");
+        return NULL;
+    }
+    if (capacity < sizeof(RingRecord) || capacity > (1u << 31)) {
+        SDL_InvalidParamError("capacity");
+        return NULL;
+    }
+    Uint32 size = sizeof(RingRecord);
+    while (size < capacity) {
+        size *= 2;
+    }
+    return MapRing(name, size);
+}
+
+SDL_GPUDRing* SDL_OpenGPUDRing(
+    const char* name)
+{
+    if (!name) {
+        SDL_InvalidParamError("name");
+        return NULL;
+    }
+    return MapRing(name, 0);
+}
+
+void SDL_CloseGPUDRing(
+    SDL_GPUDRing* ring)
+{
+    if (!ring) {
+        return;
+    }
+#if defined(SDL_PLATFORM_WINDOWS)
+    UnmapViewOfFile(ring->header);
+    CloseHandle(ring->mapping);
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+    munmap(ring->header, ring->size);
+    if (ring->name) {
+        shm_unlink(ring->name);
+    }
+#endif
+    Free(ring->name);
+    Free(ring);
+}
+
+bool SDL_WriteGPUDRing(
+    SDL_GPUDRing* ring,
+    const SDL_GPUPrimitiveType primitive_type,
+    const SDL_GPUDVertex* vertices,
+    const int num_vertices)
+{
+    if (!ring) {
+        return SDL_InvalidParamError("ring");
+    }
+    if (!vertices) {
+        return SDL_InvalidParamError("vertices");
+    }
+    CommandType type;
+    switch (primitive_type) {
+    case SDL_GPU_PRIMITIVETYPE_LINELIST:
+        type = COMMAND_TYPE_LINE;
+        break;
+    case SDL_GPU_PRIMITIVETYPE_TRIANGLELIST:
+        type = COMMAND_TYPE_POLY;
+        break;
+    default:
+        return SDL_InvalidParamError("primitive_type");
+    }
+    const Uint32 capacity = ring->capacity;
+    const Uint32 size = num_vertices * sizeof(SDL_GPUDVertex);
+    if (num_vertices <= 0 || size % GetPrimitiveSize(type) || sizeof(RingRecord) + size > capacity) {
+        return SDL_InvalidParamError("num_vertices");
+    }
+    Uint32 head = SDL_GetAtomicU32(&ring->header->head);
+    const Uint32 tail = SDL_GetAtomicU32(&ring->header->tail);
+    const Uint32 remaining = capacity - (head & (capacity - 1));
+    Uint32 required = sizeof(RingRecord) + size;
+    if (remaining < required) {
+        required += remaining;
+    }
+    if (required > capacity - (head - tail)) {
+        return SDL_SetError("Ring is full");
+    }
+    RingRecord* record = (RingRecord*) (ring->data + (head & (capacity - 1)));
+    if (remaining < sizeof(RingRecord) + size) {
+        record->type = RING_PADDING;
+        record->size = remaining - sizeof(RingRecord);
+        head += remaining;
+        record = (RingRecord*) ring->data;
+    }
+    record->type = type;
+    record->size = size;
+    SDL_memcpy(record + 1, vertices, size);
+    SDL_MemoryBarrierRelease();
+    SDL_SetAtomicU32(&ring->header->head, head + sizeof(RingRecord) + size);
+    return true;
+}
+
+void SDL_DrawGPUDRing(
+    SDL_GPUDRing* ring)
+{
+    if (!device) {
+        return;
+    }
+    if (!ring) {
+        SDL_InvalidParamError("ring");
+        return;
+    }
+    const Uint32 capacity = ring->capacity;
+    const Uint32 head = SDL_GetAtomicU32(&ring->header->head);
+    Uint32 tail = SDL_GetAtomicU32(&ring->header->tail);
+    SDL_MemoryBarrierAcquire();
+    /* Records are checked against the ring before they are read, the
+     * producer is another process and may be broken. Whatever it wrote is
+     * dropped at the first invalid record, so that the next one can be read */
+    if (head - tail > capacity || head % sizeof(RingRecord) || tail % sizeof(RingRecord)) {
+        SDL_SetError("Invalid ring head %u and tail %u", head, tail);
+        SDL_SetAtomicU32(&ring->header->tail, head);
+        return;
+    }
+    while (tail != head) {
+        const Uint32 offset = tail & (capacity - 1);
+        const RingRecord* record = (const RingRecord*) (ring->data + offset);
+        const Uint32 type = record->type;
+        const Uint32 size = record->size;
+        Uint32 unit;
+        switch (type) {
+        case RING_PADDING:
+            unit = sizeof(RingRecord);
+            break;
+        case COMMAND_TYPE_LINE:
+        case COMMAND_TYPE_POLY:
+            unit = GetPrimitiveSize(type);
+            break;
+        default:
+            SDL_SetError("Invalid ring record type %u", type);
+            SDL_SetAtomicU32(&ring->header->tail, head);
+            return;
+        }
+        if (size % unit || size > capacity - offset - sizeof(RingRecord) ||
+            size > head - tail - sizeof(RingRecord)) {
+            SDL_SetError("Invalid ring record size %u", size);
+            SDL_SetAtomicU32(&ring->header->tail, head);
+            return;
+        }
+        /* Copied straight from shared memory into the mapped transfer buffer */
+        if (type != RING_PADDING) {
+            PushBaked(type, (Uint8*) (record + 1), size);
+        }
+        tail += sizeof(RingRecord) + size;
+        SDL_MemoryBarrierRelease();
+        SDL_SetAtomicU32(&ring->header->tail, tail);
+    }
+}
+
+SDL_GPUDPointCloud* SDL_CreateGPUDPointCloud(
+    SDL_GPUCommandBuffer* command_buffer,
+    const SDL_GPUDVertex* points,
+    const Uint32 num_points)
+{
+    if (!device) {
+        return NULL;
+    }
+    if (!command_buffer) {
+        SDL_InvalidParamError("command_buffer");
+        return NULL;
+    }
+    if (!points) {
+        SDL_InvalidParamError("points");
+        return NULL;
+    }
+    if (!num_points) {
+        SDL_InvalidParamError("num_points");
+        return NULL;
+    }
+    if (!point_vertex_shader) {
+        SDL_SetError("Missing point shader build, rerun build_shaders.sh");
+        return NULL;
+    }
+    const Uint32 size = num_points * sizeof(SDL_GPUDVertex);
+    SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+    transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer_info.size = size;
+    SDL_GPUTransferBuffer* transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+    if (!transfer_buffer) {
+        return NULL;
+    }
+    void* data = SDL_MapGPUTransferBuffer(device, transfer_buffer, false);
+    if (!data) {
+        SDL_ReleaseGPUTransferBuffer(device, transfer_buffer);
+        return NULL;
+    }
+    SDL_memcpy(data, points, size);
+    SDL_UnmapGPUTransferBuffer(device, transfer_buffer);
+    SDL_GPUBufferCreateInfo buffer_info = {0};
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
+    buffer_info.size = size;
+    SDL_GPUBuffer* buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+    SDL_GPUCopyPass* copy_pass = NULL;
+    if (buffer) {
+        copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    }
+    if (copy_pass) {
+        SDL_GPUTransferBufferLocation location = {0};
+        SDL_GPUBufferRegion region = {0};
+        location.transfer_buffer = transfer_buffer;
+        region.buffer = buffer;
+        region.size = size;
+        SDL_UploadToGPUBuffer(copy_pass, &location, &region, false);
+        SDL_EndGPUCopyPass(copy_pass);
+    }
+    SDL_ReleaseGPUTransferBuffer(device, transfer_buffer);
+    SDL_GPUDPointCloud* cloud = NULL;
+    if (copy_pass) {
+        cloud = SDL_WrapGPUDPointCloud(buffer, num_points);
+    }
+    if (!cloud) {
+        SDL_ReleaseGPUBuffer(device, buffer);
+        return NULL;
+    }
+    cloud->owned = true;
+    return cloud;
+}
+
+SDL_GPUDPointCloud* SDL_WrapGPUDPointCloud(
+    SDL_GPUBuffer* buffer,
+    const Uint32 num_points)
+{
+    if (!device) {
+        return NULL;
+    }
+    if (!buffer) {
+        SDL_InvalidParamError("buffer");
+        return NULL;
+    }
+    if (!num_points) {
+        SDL_InvalidParamError("num_points");
+        return NULL;
+    }
+    if (!point_vertex_shader) {
+        SDL_SetError("Missing point shader build, rerun build_shaders.sh");
+        return NULL;
+    }
+    SDL_GPUDPointCloud* cloud = Calloc(1, sizeof(SDL_GPUDPointCloud));
+    if (!cloud) {
+        return NULL;
+    }
+    cloud->buffer = buffer;
+    cloud->num_points = num_points;
+    return cloud;
+}
+
+void SDL_DestroyGPUDPointCloud(
+    SDL_GPUDPointCloud* cloud)
+{
+    if (!cloud) {
+        return;
+    }
+    if (device && cloud->owned) {
+        SDL_ReleaseGPUBuffer(device, cloud->buffer);
+    }
+    Free(cloud);
+}
+
+static CloudDraw* AddCloudDraw(
+    SDL_GPUDPointCloud* cloud,
+    const Uint32 stride,
+    const Uint32 first,
+    const Uint32 count,
+    const int index,
+    const float size)
+{
+    if (num_cloud_draws == cloud_draw_capacity) {
+        const int capacity = SDL_max(16, cloud_draw_capacity * 2);
+        CloudDraw* data = Realloc(cloud_draws, capacity * sizeof(CloudDraw));
+        if (!data) {
+            return NULL;
+        }
+        cloud_draws = data;
+        cloud_draw_capacity = capacity;
     }
-    bool status = true;
-    goto success;
-error:
-    status = false;
-success:
-    SDL_ReleaseGPUShader(device, fragment_shader);
-    SDL_ReleaseGPUShader(device, vertex_shader);
-    if (!status) {
-        SDL_QuitGPUD();
+    CloudDraw* draw = &cloud_draws[num_cloud_draws++];
+    draw->cloud = cloud;
+    draw->stride = stride;
+    draw->first = first;
+    draw->count = count;
+    draw->transform = index;
+    draw->slot = slot;
+    draw->color = color;
+    draw->size = size;
+    draw->center[0] = 0.0f;
+    draw->center[1] = 0.0f;
+    return draw;
+}
+
+void SDL_DrawGPUDPointCloud(
+    SDL_GPUDPointCloud* cloud,
+    const Uint32 stride,
+    const float size)
+{
+    if (!device) {
+        return;
+    }
+    if (!cloud) {
+        SDL_InvalidParamError("cloud");
+        return;
     }
+    if (!stride) {
+        SDL_InvalidParamError("stride");
+        return;
+    }
+    if (size <= 0.0f) {
+        SDL_InvalidParamError("size");
+        return;
+    }
+    AddCloudDraw(cloud, stride, 0, cloud->num_points, transform, size);
+}
+
+bool SDL_SetGPUDBudget(
+    const Uint32 size,
+    const SDL_GPUDOverflow policy)
+{
+    if (device) {
+        return SDL_SetError("Cannot change the budget after SDL_InitGPUD");
+    }
+    if (size && threaded) {
+        return SDL_SetError("A budget cannot be combined with threading");
+    }
+    budget = size;
+    overflow = policy;
     return true;
 }
 
-void SDL_QuitGPUD()
+/* Primitives carry the index they were recorded with in the frame hash, the
+ * matrices are compared by FindCachedFrame */
+static int AddTransform(
+    const float* matrix)
 {
-    if (!device) {
+    if (num_transforms >= transform_capacity) {
+        const int capacity = SDL_max(64, transform_capacity * 2);
+        Transform* data = Realloc(transforms, capacity * sizeof(Transform));
+        if (!data) {
+            return -1;
+        }
+        transforms = data;
+        transform_capacity = capacity;
+    }
+    SDL_memcpy(transforms[num_transforms].matrix, matrix, sizeof(Transform));
+    return num_transforms++;
+}
+
+void SDL_PushGPUDTransform(
+    const void* matrix)
+{
+    if (!matrix) {
+        SDL_InvalidParamError("matrix");
         return;
     }
-    for (Command* command = head; command;) {
-        SDL_ReleaseGPUTransferBuffer(device, command->transfer_buffer);
-        SDL_ReleaseGPUBuffer(device, command->buffer);
-        Command* prev = command;
-        command = command->next;
-        free(prev);
+    if (transform_depth == TRANSFORM_DEPTH) {
+        SDL_SetError("Transform stack overflow");
+        return;
     }
-    head = NULL;
-    tail = NULL;
-    SDL_ReleaseGPUGraphicsPipeline(device, line_2d_pipeline);
-    SDL_ReleaseGPUGraphicsPipeline(device, line_3d_pipeline);
-    SDL_ReleaseGPUGraphicsPipeline(device, poly_2d_pipeline);
-    SDL_ReleaseGPUGraphicsPipeline(device, poly_3d_pipeline);
-    line_2d_pipeline = NULL;
-    line_3d_pipeline = NULL;
-    poly_2d_pipeline = NULL;
-    poly_3d_pipeline = NULL;
-    device = NULL;
+    float product[16];
+    if (transform) {
+        MultiplyMatrix(product, transforms[transform].matrix, matrix);
+    } else {
+        SDL_memcpy(product, matrix, sizeof(product));
+    }
+    const int index = AddTransform(product);
+    if (index < 0) {
+        return;
+    }
+    transform_stack[transform_depth++] = transform;
+    transform = index;
 }
 
-void SDL_SetGPUDColor(
-    const SDL_FColor* handle)
+void SDL_PopGPUDTransform()
 {
-    if (!device) {
+    if (!transform_depth) {
+        SDL_SetError("Transform stack underflow");
         return;
     }
-    if (!handle) {
-        SDL_InvalidParamError("handle");
+    transform = transform_stack[--transform_depth];
+}
+
+void SDL_SetGPUDTransform(
+    const void* matrix)
+{
+    if (!matrix) {
+        transform = 0;
         return;
     }
-    const Uint8 red = SDL_min(handle->r * UINT8_MAX, UINT8_MAX);
-    const Uint8 green = SDL_min(handle->g * UINT8_MAX, UINT8_MAX);
-    const Uint8 blue = SDL_min(handle->b * UINT8_MAX, UINT8_MAX);
-    const Uint8 alpha = SDL_min(handle->a * UINT8_MAX, UINT8_MAX);
-    color = red << 24 | green << 16 | blue << 8 | alpha;
+    const int index = AddTransform(matrix);
+    if (index >= 0) {
+        transform = index;
+    }
 }
 
-static void PushCommand(
-    const CommandType type,
-    void* data,
-    const Uint32 size)
+SDL_GPUDGrid* SDL_CreateGPUDGrid(
+    const float radius,
+    const int levels)
 {
-    Command* command = tail;
-    if (!command || command->type != type || command->size + size > command->capacity) {
-        command = SDL_malloc(sizeof(Command));
-        command->next = NULL;
-        command->type = type;
-        command->size = 0;
-        command->capacity = SDL_max(BUFFER_CAPACITY, size);
-        command->data = NULL;
-        SDL_GPUBufferCreateInfo buffer_info = {0};
-        buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
-        buffer_info.size = command->capacity;
-        command->buffer = SDL_CreateGPUBuffer(device, &buffer_info);
-        SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
-        transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-        transfer_buffer_info.size = command->capacity;
-        command->transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
-        command->data = SDL_MapGPUTransferBuffer(device, command->transfer_buffer, false);
-        if (!command->data || !command->buffer) {
-            SDL_ReleaseGPUBuffer(device, command->buffer);
-            SDL_ReleaseGPUTransferBuffer(device, command->transfer_buffer);
-            SDL_free(command);
-            return;
-        }
-        if (tail) {
-            tail->next = command;
-        }
-        tail = command;
-        if (!head) {
-            head = command;
-        }
+    if (!device) {
+        return NULL;
+    }
+    if (!grid_3d_pipeline) {
+        SDL_SetError("Missing grid shader build, rerun build_shaders.sh");
+        return NULL;
+    }
+    if (radius <= 0.0f) {
+        SDL_InvalidParamError("radius");
+        return NULL;
     }
-    SDL_memcpy(command->data + command->size, data, size);
-    command->size += size;
+    SDL_GPUDGrid* grid = Calloc(1, sizeof(SDL_GPUDGrid));
+    if (!grid) {
+        return NULL;
+    }
+    grid->cloud.type = CLOUD_TYPE_GRID;
+    grid->levels = SDL_clamp(levels, 1, 3);
+    grid->radius = radius;
+    return grid;
 }
 
-void SDL_DrawGPUDPoint(
+void SDL_DestroyGPUDGrid(
+    SDL_GPUDGrid* grid)
+{
+    Free(grid);
+}
+
+void SDL_DrawGPUDGrid(
+    SDL_GPUDGrid* grid,
     const SDL_GPUDVertex* center,
-    const float radius)
+    const float spacing)
 {
     if (!device) {
         return;
     }
+    if (!grid) {
+        SDL_InvalidParamError("grid");
+        return;
+    }
     if (!center) {
         SDL_InvalidParamError("center");
         return;
     }
-    if (radius < SDL_FLT_EPSILON) {
-        SDL_InvalidParamError("radius");
+    if (spacing <= 0.0f) {
+        SDL_InvalidParamError("spacing");
         return;
     }
-    SDL_GPUDVertex start = {0};
-    SDL_GPUDVertex end = {0};
-    start.x = center->x - radius;
-    start.y = center->y - radius;
-    start.z = center->z - radius;
-    end.x = center->x + radius;
-    end.y = center->y + radius;
-    end.z = center->z + radius;
-    SDL_GPUDVertex vertices[36] = {
-        {start.x, start.y, end.z, color},
-        {end.x, start.y, end.z, color},
-        {end.x, end.y, end.z, color},
-        {start.x, start.y, end.z, color},
-        {end.x, end.y, end.z, color},
-        {start.x, end.y, end.z, color},
-        {start.x, start.y, start.z, color},
-        {start.x, end.y, start.z, color},
-        {end.x, end.y, start.z, color},
-        {start.x, start.y, start.z, color},
-        {end.x, end.y, start.z, color},
-        {end.x, start.y, start.z, color},
-        {start.x, start.y, start.z, color},
-        {start.x, start.y, end.z, color},
-        {start.x, end.y, end.z, color},
-        {start.x, start.y, start.z, color},
-        {start.x, end.y, end.z, color},
-        {start.x, end.y, start.z, color},
-        {end.x, start.y, start.z, color},
-        {end.x, end.y, start.z, color},
-        {end.x, end.y, end.z, color},
-        {end.x, start.y, start.z, color},
-        {end.x, end.y, end.z, color},
-        {end.x, start.y, end.z, color},
-        {start.x, end.y, start.z, color},
-        {start.x, end.y, end.z, color},
-        {end.x, end.y, end.z, color},
-        {start.x, end.y, start.z, color},
-        {end.x, end.y, end.z, color},
-        {end.x, end.y, start.z, color},
-        {start.x, start.y, start.z, color},
-        {end.x, start.y, start.z, color},
-        {end.x, start.y, end.z, color},
-        {start.x, start.y, start.z, color},
-        {end.x, start.y, end.z, color},
-        {start.x, start.y, end.z, color},
+    /* Only the height moves the plane, the lines are fixed in the transform
+     * and the center only moves the fade */
+    float matrix[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, center->y, 0.0f, 1.0f,
     };
-    PushCommand(COMMAND_TYPE_POLY, vertices, sizeof(vertices));
+    float product[16];
+    if (transform) {
+        MultiplyMatrix(product, transforms[transform].matrix, matrix);
+    } else {
+        SDL_memcpy(product, matrix, sizeof(product));
+    }
+    const int index = AddTransform(product);
+    if (index < 0) {
+        return;
+    }
+    CloudDraw* draw = AddCloudDraw(&grid->cloud, 1, 0, 0, index, spacing);
+    if (draw) {
+        draw->center[0] = center->x;
+        draw->center[1] = center->z;
+    }
 }
 
-void SDL_DrawGPUDBox(
-    const SDL_GPUDVertex* start,
-    const SDL_GPUDVertex* end)
+SDL_GPUDGraph* SDL_CreateGPUDGraph(
+    const Uint32 capacity,
+    const Uint32 downsample)
 {
     if (!device) {
+        return NULL;
+    }
+    if (!graph_vertex_shader) {
+        SDL_SetError("Missing graph shader build, rerun build_shaders.sh");
+        return NULL;
+    }
+    if (capacity < 2 || capacity > GRAPH_MAX_CAPACITY) {
+        SDL_InvalidParamError("capacity");
+        return NULL;
+    }
+    if (!downsample) {
+        SDL_InvalidParamError("downsample");
+        return NULL;
+    }
+    SDL_GPUDGraph* graph = Calloc(1, sizeof(SDL_GPUDGraph));
+    if (!graph) {
+        return NULL;
+    }
+    graph->values = Malloc(capacity * sizeof(float));
+    SDL_GPUBufferCreateInfo buffer_info = {0};
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
+    buffer_info.size = capacity * sizeof(float);
+    graph->cloud.buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+    SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+    transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer_info.size = buffer_info.size;
+    graph->transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+    if (!graph->values || !graph->cloud.buffer || !graph->transfer_buffer) {
+        SDL_DestroyGPUDGraph(graph);
+        return NULL;
+    }
+    graph->cloud.owned = true;
+    graph->cloud.type = CLOUD_TYPE_GRAPH;
+    graph->capacity = capacity;
+    graph->downsample = downsample;
+    graph->color = color;
+    return graph;
+}
+
+void SDL_DestroyGPUDGraph(
+    SDL_GPUDGraph* graph)
+{
+    if (!graph) {
         return;
     }
-    if (!start) {
-        SDL_InvalidParamError("start");
+    if (device) {
+        SDL_ReleaseGPUBuffer(device, graph->cloud.buffer);
+        SDL_ReleaseGPUTransferBuffer(device, graph->transfer_buffer);
+    }
+    Free(graph->values);
+    Free(graph);
+}
+
+static void AddGraphValue(
+    SDL_GPUDGraph* graph,
+    const float value)
+{
+    graph->values[graph->written % graph->capacity] = value;
+    graph->written++;
+}
+
+void SDL_PushGPUDGraph(
+    SDL_GPUDGraph* graph,
+    const float value)
+{
+    if (!graph) {
+        SDL_InvalidParamError("graph");
         return;
     }
-    if (!end) {
-        SDL_InvalidParamError("end");
+    if (graph->downsample == 1) {
+        AddGraphValue(graph, value);
         return;
     }
-    SDL_GPUDVertex vertices[24] = {
-        {start->x, start->y, start->z, color},
-        {end->x, start->y, start->z, color},
-        {end->x, start->y, start->z, color},
-        {end->x, start->y, end->z, color},
-        {end->x, start->y, end->z, color},
-        {start->x, start->y, end->z, color},
-        {start->x, start->y, end->z, color},
-        {start->x, start->y, start->z, color},
-        {start->x, end->y, start->z, color},
-        {end->x, end->y, start->z, color},
-        {end->x, end->y, start->z, color},
-        {end->x, end->y, end->z, color},
-        {end->x, end->y, end->z, color},
-        {start->x, end->y, end->z, color},
-        {start->x, end->y, end->z, color},
-        {start->x, end->y, start->z, color},
-        {start->x, start->y, start->z, color},
-        {start->x, end->y, start->z, color},
-        {end->x, start->y, start->z, color},
-        {end->x, end->y, start->z, color},
-        {end->x, start->y, end->z, color},
-        {end->x, end->y, end->z, color},
-        {start->x, start->y, end->z, color},
-        {start->x, end->y, end->z, color},
-    };
-    PushCommand(COMMAND_TYPE_LINE, vertices, sizeof(vertices));
+    if (!graph->bucket_size || value < graph->min) {
+        graph->min = value;
+        graph->bucket_min = graph->bucket_size;
+    }
+    if (!graph->bucket_size || value > graph->max) {
+        graph->max = value;
+        graph->bucket_max = graph->bucket_size;
+    }
+    if (++graph->bucket_size < graph->downsample) {
+        return;
+    }
+    /* Keeps the order of the extremes so spikes keep their shape */
+    if (graph->bucket_min <= graph->bucket_max) {
+        AddGraphValue(graph, graph->min);
+        AddGraphValue(graph, graph->max);
+    } else {
+        AddGraphValue(graph, graph->max);
+        AddGraphValue(graph, graph->min);
+    }
+    graph->bucket_size = 0;
 }
 
-void SDL_DrawGPUDLine(
-    const SDL_GPUDVertex* start,
-    const SDL_GPUDVertex* end)
+void SDL_DrawGPUDGraph(
+    SDL_GPUDGraph* graph,
+    const SDL_FRect* rect,
+    const float min,
+    const float max)
 {
     if (!device) {
         return;
     }
-    if (!start) {
-        SDL_InvalidParamError("start");
+    if (!graph) {
+        SDL_InvalidParamError("graph");
         return;
     }
-    if (!end) {
-        SDL_InvalidParamError("end");
+    if (!rect) {
+        SDL_InvalidParamError("rect");
         return;
     }
-    SDL_GPUDVertex vertices[2];
-    vertices[0] = *start;
-    vertices[1] = *end;
-    vertices[0].color = color;
-    vertices[1].color = color;
-    PushCommand(COMMAND_TYPE_LINE, vertices, sizeof(vertices));
+    if (max <= min) {
+        SDL_InvalidParamError("max");
+        return;
+    }
+    const Uint32 count = SDL_min(graph->written, graph->capacity);
+    if (count < 2) {
+        return;
+    }
+    const Uint32 first = graph->written > graph->capacity ? graph->written % graph->capacity : 0;
+    const float scale_x = rect->w / (graph->capacity - 1);
+    const float scale_y = rect->h / (max - min);
+    float matrix[16] = {0};
+    matrix[0] = scale_x;
+    matrix[5] = -scale_y;
+    matrix[10] = 1.0f;
+    matrix[12] = rect->x;
+    matrix[13] = rect->y + rect->h + min * scale_y;
+    matrix[15] = 1.0f;
+    float product[16];
+    if (transform) {
+        MultiplyMatrix(product, transforms[transform].matrix, matrix);
+    } else {
+        SDL_memcpy(product, matrix, sizeof(product));
+    }
+    const int index = AddTransform(product);
+    if (index >= 0) {
+        AddCloudDraw(&graph->cloud, 1, first, count, index, 0.0f);
+    }
 }
 
-void SDL_DrawGPUDSphere(
-    const SDL_GPUDVertex* center,
-    const float radius)
+SDL_GPUDTrails* SDL_CreateGPUDTrails(
+    const Uint32 num_trails,
+    const Uint32 length)
+{
+    if (!device) {
+        return NULL;
+    }
+    if (!trail_vertex_shader) {
+        SDL_SetError("Missing trail shader build, rerun build_shaders.sh");
+        return NULL;
+    }
+    if (!num_trails) {
+        SDL_InvalidParamError("num_trails");
+        return NULL;
+    }
+    if (length < 2 || (Uint64) num_trails * length > TRAIL_MAX_POSITIONS) {
+        SDL_InvalidParamError("length");
+        return NULL;
+    }
+    SDL_GPUDTrails* trails = Calloc(1, sizeof(SDL_GPUDTrails));
+    if (!trails) {
+        return NULL;
+    }
+    trails->cloud.owned = true;
+    trails->cloud.type = CLOUD_TYPE_TRAILS;
+    trails->num_trails = num_trails;
+    trails->length = length;
+    trails->positions = Malloc(num_trails * length * sizeof(SDL_GPUDVertex));
+    SDL_GPUBufferCreateInfo buffer_info = {0};
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
+    buffer_info.size = num_trails * length * sizeof(SDL_GPUDVertex);
+    trails->cloud.buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+    SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+    transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer_info.size = buffer_info.size;
+    trails->transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+    if (!trails->positions || !trails->cloud.buffer || !trails->transfer_buffer) {
+        SDL_DestroyGPUDTrails(trails);
+        return NULL;
+    }
+    return trails;
+}
+
+void SDL_DestroyGPUDTrails(
+    SDL_GPUDTrails* trails)
+{
+    if (!trails) {
+        return;
+    }
+    if (device) {
+        SDL_ReleaseGPUBuffer(device, trails->cloud.buffer);
+        SDL_ReleaseGPUTransferBuffer(device, trails->transfer_buffer);
+    }
+    Free(trails->positions);
+    Free(trails);
+}
+
+void SDL_PushGPUDTrails(
+    SDL_GPUDTrails* trails,
+    const SDL_GPUDVertex* positions)
+{
+    if (!trails) {
+        SDL_InvalidParamError("trails");
+        return;
+    }
+    if (!positions) {
+        SDL_InvalidParamError("positions");
+        return;
+    }
+    const Uint32 index = trails->written % trails->length;
+    SDL_memcpy(&trails->positions[index * trails->num_trails], positions, trails->num_trails * sizeof(SDL_GPUDVertex));
+    trails->written++;
+}
+
+void SDL_DrawGPUDTrails(
+    SDL_GPUDTrails* trails)
 {
     if (!device) {
         return;
     }
-    if (!center) {
-        SDL_InvalidParamError("center");
+    if (!trails) {
+        SDL_InvalidParamError("trails");
         return;
     }
-    if (radius < SDL_FLT_EPSILON) {
-        SDL_InvalidParamError("radius");
+    if (trails->written < 2) {
         return;
     }
-    SDL_GPUDVertex vertices[SPHERE_VERTICES * SPHERE_VERTICES * 2];
-    int index = 0;
-    for (int i = 0; i < SPHERE_VERTICES; i++) {
-        const float phi = i / (float) (SPHERE_VERTICES - 1) * SDL_PI_F;
-        for (int j = 0; j < SPHERE_VERTICES; j++) {
-            const float theta = j / (float) (SPHERE_VERTICES - 1) * 2 * SDL_PI_F;
-            vertices[index].x = center->x + radius * SDL_sin(phi) * SDL_cos(theta);
-            vertices[index].y = center->y + radius * SDL_sin(phi) * SDL_sin(theta);
-            vertices[index].z = center->z + radius * SDL_cos(phi);
-            vertices[index].color = center->color;
-            index++;
-        }
+    /* Before the history is full the segments start at slot zero, after it
+     * they start at the oldest slot and skip the one from the newest */
+    Uint32 first = 0;
+    Uint32 count = trails->written - 1;
+    if (trails->written >= trails->length) {
+        first = trails->written % trails->length;
+        count = trails->length - 1;
     }
-    for (int i = 0; i < SPHERE_VERTICES - 1; i++) {
-        for (int j = 0; j < SPHERE_VERTICES; j++) {
-            const int curr = i * SPHERE_VERTICES + j;
-            const int next = ((i + 1) * SPHERE_VERTICES + j) % (SPHERE_VERTICES * SPHERE_VERTICES);
-            SDL_DrawGPUDLine(&vertices[curr], &vertices[next]);
-        }
+    AddCloudDraw(&trails->cloud, 1, first, count, transform, 0.0f);
+}
+
+SDL_GPUDMesh* SDL_WrapGPUDMesh(
+    SDL_GPUBuffer* vertex_buffer,
+    const Uint32 stride,
+    const Uint32 offset,
+    SDL_GPUBuffer* index_buffer,
+    const SDL_GPUIndexElementSize index_size,
+    const Uint32 num_elements)
+{
+    if (!device) {
+        return NULL;
     }
-    for (int i = 0; i < SPHERE_VERTICES - 1; i++) {
-        for (int j = 0; j < SPHERE_VERTICES - 1; j++) {
-            const int curr = i * SPHERE_VERTICES + j;
-            const int next = i * SPHERE_VERTICES + (j + 1);
-            SDL_DrawGPUDLine(&vertices[curr], &vertices[next]);
-        }
+    if (!vertex_buffer) {
+        SDL_InvalidParamError("vertex_buffer");
+        return NULL;
     }
+    if (offset + 3 * sizeof(float) > stride) {
+        SDL_InvalidParamError("offset");
+        return NULL;
+    }
+    if (index_buffer && index_size != SDL_GPU_INDEXELEMENTSIZE_16BIT &&
+        index_size != SDL_GPU_INDEXELEMENTSIZE_32BIT) {
+        SDL_InvalidParamError("index_size");
+        return NULL;
+    }
+    if (!num_elements) {
+        SDL_InvalidParamError("num_elements");
+        return NULL;
+    }
+    const WireframePipeline* pipeline = GetWireframePipeline(stride, offset);
+    if (!pipeline) {
+        return NULL;
+    }
+    SDL_GPUDMesh* mesh = Calloc(1, sizeof(SDL_GPUDMesh));
+    if (!mesh) {
+        return NULL;
+    }
+    mesh->cloud.buffer = vertex_buffer;
+    mesh->cloud.index_buffer = index_buffer;
+    mesh->cloud.num_points = num_elements;
+    mesh->cloud.type = CLOUD_TYPE_MESH;
+    mesh->pipeline = pipeline;
+    mesh->index_size = index_size;
+    return mesh;
 }
 
-static void TextFunc(
-    const int x1,
-    const int y1,
-    const int x2,
-    const int y2)
+void SDL_DestroyGPUDMesh(
+    SDL_GPUDMesh* mesh)
 {
-    SDL_GPUDVertex start = {x1, y1, 0.0f};
-    SDL_GPUDVertex end = {x2, y2, 0.0f};
-    SDL_DrawGPUDLine(&start, &end);
+    Free(mesh);
 }
 
-/* Modified from: https://github.com/gamelly/gly-type */
-void SDL_DrawGPUDText(
-    const char* text,
-    const float x,
-    const float y,
-    const int size)
+void SDL_DrawGPUDWireframe(
+    SDL_GPUDMesh* mesh)
 {
     if (!device) {
         return;
     }
-    if (!text) {
-        SDL_InvalidParamError("text");
+    if (!mesh) {
+        SDL_InvalidParamError("mesh");
         return;
     }
-    if (size < 3) {
-        SDL_InvalidParamError("size");
+    AddCloudDraw(&mesh->cloud, 1, 0, mesh->cloud.num_points, transform, 0.0f);
+}
+
+void SDL_SetGPUDSlot(
+    const SDL_GPUDSlot value)
+{
+    if (value < SDL_GPUD_SLOT_WORLD || value > SDL_GPUD_SLOT_CUSTOM) {
+        SDL_InvalidParamError("slot");
         return;
     }
-    static const unsigned char segments_1[] = {
-        0x00, 0x28, 0x81, 0x13, 0xbb, 0x42, 0x33, 0x80, 0x12, 0x21, 0x00, 0x09,
-        0x20, 0x00, 0x80, 0x00, 0x7e, 0x30, 0x76, 0x3e, 0x8c, 0xb9, 0xf9, 0x0f,
-        0xff, 0xbf, 0xc0, 0x60, 0x00, 0x03, 0x00, 0x00, 0xf7, 0xcf, 0xf9, 0xf3,
-        0xe1, 0xf3, 0xc3, 0xfb, 0xcc, 0x33, 0x7c, 0xc0, 0xf0, 0xcf, 0xcc, 0xff,
-        0xc7, 0x8f, 0xc7, 0xbb, 0x03, 0xfc, 0x84, 0xfc, 0x00, 0x84, 0x33, 0xe1,
-        0x00, 0x1e, 0x00, 0x30, 0x00, 0x70, 0xe0, 0xf1, 0x1c, 0xe1, 0xc1, 0xe1,
-        0xc0, 0xc0, 0x60, 0xc0, 0xe0, 0xc9, 0xc1, 0xe1, 0xc1, 0x0e, 0xc0, 0xa1,
-        0x03, 0xe0, 0x04, 0xe4, 0x00, 0x00, 0x16, 0x33, 0x00, 0x33, 0x85
-    };
-    static const unsigned char segments_2[] = {
-        0x00, 0x80, 0x00, 0x80, 0x07, 0x80, 0x4a, 0x00, 0xc8, 0xb0, 0x7b, 0x80,
-        0x80, 0x03, 0x80, 0x50, 0x88, 0x8c, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
-        0x03, 0x03, 0x80, 0x80, 0xc8, 0x80, 0x48, 0x9e, 0x06, 0x03, 0x07, 0x00,
-        0xb0, 0x03, 0x03, 0x02, 0x03, 0x04, 0x00, 0x31, 0x00, 0x04, 0x28, 0x00,
-        0x03, 0x03, 0x23, 0x03, 0x04, 0x00, 0xe0, 0x04, 0x78, 0x07, 0x50, 0x00,
-        0x28, 0x00, 0x98, 0x00, 0x08, 0x0d, 0x05, 0x00, 0x06, 0x01, 0x01, 0xa2,
-        0x05, 0x00, 0x04, 0x8d, 0x00, 0x94, 0x04, 0x04, 0x05, 0x06, 0x88, 0xc0,
-        0x04, 0x04, 0xa4, 0xa4, 0x78, 0x58, 0xa0, 0x49, 0x04, 0x32, 0x06
-    };
-    unsigned char c, m1, m2, segment;
-    int sp2, sm1, x1, x2, x3, y1, y2, y3;
-    int sd4, x2m1, x2p1, y2m1, y2p1, sne1;
-    sp2 = size + 2;
-    sm1 = size - 1;
-    sd4 = size / 4;
-    sne1 = ~size & 1;
-    x1 = x;
-    y1 = y;
-    y2 = y1 + (sm1 / 2);
-    y3 = y1 + sm1;
-    if (size < 0) {
-        y3 = y3 ^ y1;
-        y1 = y3 ^ y1;
-        y3 = y3 ^ y1;
-    }
-    while (*text) {
-        x2 = x1 + (sm1 / 2);
-        x3 = x1 + sm1;
-        c = *text - 0x20;
-        if (c > (0x7f - 0x20)) {
-            goto gly_type_skip_char;
-        }
-        m1 = segments_1[c];
-        m2 = segments_2[c];
-        if (m2 == 0x80) {
-            segment = 0;
-            x2m1 = x2 - sd4;
-            x2p1 = x2 + sd4 + sne1;
-            y2m1 = y2 - sd4 + sne1;
-            y2p1 = y2 + sd4;
-            while (segment < 8) {
-                switch (m1 & (1 << segment) ? segment : 8) {
-                case 0: TextFunc(x1, y2m1, x3, y2m1); break;
-                case 1: TextFunc(x1, y2p1, x3, y2p1); break;
-                case 2: TextFunc(x2, y2, x2, y3); break;
-                case 3: TextFunc(x2, y1, x2, y2p1); break;
-                case 4:
-                    TextFunc(x2m1, y1, x2m1, y3);
-                    TextFunc(x2p1, y1, x2p1, y3);
-                    break;
-                case 5: TextFunc(x2m1, y3, x2p1, y2p1); break;
-                case 6:
-                    TextFunc(x2p1, y2m1, x2p1, y1);
-                    TextFunc(x2m1, y2m1, x2m1, y1);
-                    TextFunc(x2m1, y2m1, x2p1, y2m1);
-                    TextFunc(x2m1, y1, x2p1, y1);
-                    break;
-                case 7:
-                    TextFunc(x2m1, y2p1, x2p1, y2p1);
-                    TextFunc(x2m1, y2p1, x2m1, y3);
-                    TextFunc(x2p1, y2p1, x2p1, y3);
-                    TextFunc(x2m1, y3, x2p1, y3);
-                    break;
-                }
-                segment++;
-            }
-            goto gly_type_next_char;
-        }
-        if ('a' <= *text && *text <= 'z' && !(m1 & 0xe1) && !(m2 & 0x49)) {
-            x3 = x2;
-            x2 = x1;
-        }
-        segment = 0;
-        while (segment < 8) {
-            switch (m1 & (1 << segment) ? segment : 8) {
-            case 0: TextFunc(x1, y1, x2, y1); break;
-            case 1: TextFunc(x2, y1, x3, y1); break;
-            case 2: TextFunc(x3, y1, x3, y2); break;
-            case 3: TextFunc(x3, y2, x3, y3); break;
-            case 4: TextFunc(x2, y3, x3, y3); break;
-            case 5: TextFunc(x1, y3, x2, y3); break;
-            case 6: TextFunc(x1, y2, x1, y3); break;
-            case 7: TextFunc(x1, y1, x1, y2); break;
-            }
-            segment++;
-        }
-        segment = 0;
-        while (segment < 7) {
-            switch (m2 & (1 << segment) ? segment : 7) {
-            case 0: TextFunc(x1, y2, x2, y2); break;
-            case 1: TextFunc(x2, y2, x3, y2); break;
-            case 2:
-                m2 & 0x3 ? TextFunc(x2, y2, x2, m1 & 0x03 ? y1 : y3)
-                         : TextFunc(x2, y1, x2, y3);
-                break;
-            case 3:
-                m2 & 0x80 ? TextFunc(x1, y2, x2, y1)
-                          : TextFunc(x1, y1, x2, y2);
-                break;
-            case 4:
-                m2 & 0x80 ? TextFunc(x2, y1, x3, y2)
-                          : TextFunc(x2, y2, x3, y1);
-                break;
-            case 5:
-                m2 & 0x80 ? TextFunc(x2, y3, x3, y2)
-                          : TextFunc(x2, y2, x3, y3);
-                break;
-            case 6:
-                m2 & 0x80 ? TextFunc(x1, y2, x2, y3)
-                          : TextFunc(x1, y3, x2, y2);
-                break;
-            }
-            segment++;
-        }
-    gly_type_next_char:
-        x1 += sp2;
-    gly_type_skip_char:
-        text++;
-    }
+    slot = value;
 }
 
-void SDL_SubmitGPUD(
-    SDL_GPUCommandBuffer* command_buffer,
-    SDL_GPUTexture* color_texture,
-    SDL_GPUTexture* depth_texture,
+void SDL_SetGPUDCustomMatrix(
     const void* matrix)
 {
-    if (!device) {
-        return;
-    }
-    if (!command_buffer) {
-        SDL_InvalidParamError("command_buffer");
+    if (!matrix) {
+        for (int i = 0; i < 16; i++) {
+            custom_matrix[i] = i % 5 ? 0.0f : 1.0f;
+        }
         return;
     }
-    if (!color_texture) {
-        SDL_InvalidParamError("color_texture");
-        return;
+    SDL_memcpy(custom_matrix, matrix, sizeof(custom_matrix));
+}
+
+void SDL_SetGPUDPriority(
+    const int value)
+{
+    priority = value;
+}
+
+void SDL_GetGPUDOverflows(
+    Uint64* dropped,
+    Uint64* grown)
+{
+    if (dropped) {
+        *dropped = dropped_bytes;
     }
-    if (!matrix) {
-        SDL_InvalidParamError("matrix");
-        return;
+    if (grown) {
+        *grown = grown_bytes;
     }
-    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
-    if (!copy_pass) {
-        return;
+}
+
+void SDL_SetGPUDDeduplicate(
+    const bool enabled)
+{
+    deduplicate = enabled;
+}
+
+void SDL_GetGPUDDuplicates(
+    int* primitives,
+    int* duplicates,
+    Uint32* bytes)
+{
+    if (primitives) {
+        *primitives = last_hash_set.primitives;
     }
-    for (Command* command = head; command; command = command->next) {
-        SDL_UnmapGPUTransferBuffer(device, command->transfer_buffer);
-        command->data = NULL;
-        SDL_GPUTransferBufferLocation location = {0};
-        SDL_GPUBufferRegion region = {0};
-        location.transfer_buffer = command->transfer_buffer;
-        region.buffer = command->buffer;
-        region.size = command->size;
-        SDL_UploadToGPUBuffer(copy_pass, &location, &region, false);
+    if (duplicates) {
+        *duplicates = last_hash_set.duplicates;
     }
-    SDL_EndGPUCopyPass(copy_pass);
-    SDL_GPUColorTargetInfo color_info = {0};
-    color_info.texture = color_texture;
-    color_info.load_op = SDL_GPU_LOADOP_LOAD;
-    color_info.store_op = SDL_GPU_STOREOP_STORE;
-    SDL_GPURenderPass* render_pass;
-    if (depth_texture) {
-        SDL_GPUDepthStencilTargetInfo depth_info = {0};
-        depth_info.texture = depth_texture;
-        depth_info.load_op = SDL_GPU_LOADOP_LOAD;
-        depth_info.store_op = SDL_GPU_STOREOP_STORE;
-        render_pass = SDL_BeginGPURenderPass(command_buffer, &color_info, 1, &depth_info);
-    } else {
-        render_pass = SDL_BeginGPURenderPass(command_buffer, &color_info, 1, NULL);
+    if (bytes) {
+        *bytes = last_hash_set.bytes;
     }
-    if (!render_pass) {
+}
+
+void SDL_SetGPUDFrameCache(
+    const bool enabled)
+{
+    if (head) {
+        SDL_SetError("Cannot change the frame cache while recording");
         return;
     }
-    SDL_GPUGraphicsPipeline* pipeline1 = NULL;
-    SDL_GPUGraphicsPipeline* pipeline2 = NULL;
-    for (Command* command = head; command;) {
-        switch (command->type) {
-        case COMMAND_TYPE_LINE:
-            if (depth_texture) {
-                pipeline2 = line_3d_pipeline;
-            } else {
-                pipeline2 = line_2d_pipeline;
-            }
-            break;
-        case COMMAND_TYPE_POLY:
-            if (depth_texture) {
-                pipeline2 = poly_3d_pipeline;
-            } else {
-                pipeline2 = poly_2d_pipeline;
-            }
-            break;
+    frame_cache = enabled;
+    if (!enabled && device) {
+        for (int i = 0; i < CACHED_FRAMES; i++) {
+            FreeCachedFrame(&cached_frames[i]);
+            SDL_zero(cached_frames[i]);
         }
-        if (pipeline1 != pipeline2) {
-            pipeline1 = pipeline2;
-            SDL_BindGPUGraphicsPipeline(render_pass, pipeline1);
-            SDL_PushGPUVertexUniformData(command_buffer, 0, matrix, 16 * sizeof(float));
-        }
-        SDL_GPUBufferBinding binding = {0};
-        binding.buffer = command->buffer;
-        SDL_BindGPUVertexBuffers(render_pass, 0, &binding, 1);
-        SDL_DrawGPUPrimitives(render_pass, command->size / (4 * sizeof(float)), 1, 0, 0);
-        SDL_ReleaseGPUTransferBuffer(device, command->transfer_buffer);
-        SDL_ReleaseGPUBuffer(device, command->buffer);
-        Command* prev = command;
-        command = command->next;
-        free(prev);
     }
-    SDL_EndGPURenderPass(render_pass);
-    head = NULL;
-    tail = NULL;
+}
+
+void SDL_SetGPUDTranslucency(
+    const SDL_GPUDTranslucency handle)
+{
+    translucency = handle;
 }
 
 #endif /* ifdef SDL_GPU_IMPL */
\ No newline at end of file
@@ -10,7 +10,7 @@ fi
 
 SHADERCROSS="bin/$PLATFORM/shadercross.exe"
 INCLUDE="SDL_gpud_shaders.h"
-SHADERS=("shader.frag" "shader.vert")
+SHADERS=("composite.frag" "depth.frag" "fullscreen.vert" "graph.vert" "grid.frag" "grid.vert" "label.vert" "point.vert" "resolve.frag" "shader.frag" "shader.vert" "shape.comp" "sphere.frag" "sphere.vert" "trail.vert" "translucent.frag")
 
 rm -f $INCLUDE
 for FILE in "${SHADERS[@]}"; do
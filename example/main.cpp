@@ -38,6 +38,40 @@ int main(int argc, char** argv)
         SDL_Log("Failed to initialize SDL GPUD: %s", SDL_GetError());
         return EXIT_FAILURE;
     }
+    /* Grids and graphs need a shader build for the device, the example runs without */
+    SDL_GPUDGrid* grid = SDL_CreateGPUDGrid(100.0f, 2);
+    if (!grid) {
+        SDL_Log("Failed to create grid: %s", SDL_GetError());
+    }
+    SDL_SetGPUDColor({0.0f, 1.0f, 0.0f, 1.0f});
+    SDL_GPUDGraph* frame_times = SDL_CreateGPUDGraph(240, 1);
+    if (!frame_times) {
+        SDL_Log("Failed to create graph: %s", SDL_GetError());
+    }
+    Uint64 frame_start = SDL_GetTicksNS();
+    /* Streams the 3D primitives through memory and back to exercise the viewer */
+    SDL_IOStream* loopback = NULL;
+    /* Streams the primitives to a file or FIFO instead of drawing them */
+    SDL_IOStream* sender = NULL;
+    /* Draws the primitives read from a file or FIFO instead of the scene */
+    SDL_IOStream* viewer = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (!SDL_strcmp(argv[i], "--loopback")) {
+            loopback = SDL_IOFromDynamicMem();
+            SDL_BeginGPUDStream(loopback);
+        } else if (!SDL_strcmp(argv[i], "--stream") && i + 1 < argc) {
+            if (!(sender = SDL_IOFromFile(argv[++i], "wb"))) {
+                SDL_Log("Failed to open stream: %s", SDL_GetError());
+                return EXIT_FAILURE;
+            }
+            SDL_BeginGPUDStream(sender);
+        } else if (!SDL_strcmp(argv[i], "--viewer") && i + 1 < argc) {
+            if (!(viewer = SDL_IOFromFile(argv[++i], "rb"))) {
+                SDL_Log("Failed to open stream: %s", SDL_GetError());
+                return EXIT_FAILURE;
+            }
+        }
+    }
     glm::vec3 position{};
     glm::vec3 up{0.0f, 1.0f, 0.0f};
     glm::vec3 forward{0.0f, 0.0f, 1.0f};
@@ -131,6 +165,19 @@ int main(int argc, char** argv)
             continue;
         }
         SDL_EndGPURenderPass(render_pass);
+        if (viewer) {
+            /* Reads block until the sender streams its next submit */
+            float matrix[16];
+            bool depth;
+            if (SDL_ReceiveGPUDStream(viewer, matrix, &depth)) {
+                SDL_SubmitGPUD(command_buffer, color_texture, depth ? depth_texture : NULL, matrix);
+            } else {
+                SDL_Log("Failed to receive stream: %s", SDL_GetError());
+                running = false;
+            }
+            SDL_SubmitGPUCommandBuffer(command_buffer);
+            continue;
+        }
         const bool* keys = SDL_GetKeyboardState(NULL);
         if (keys[SDL_SCANCODE_W]) {
             position += forward * SPEED;
@@ -153,7 +200,6 @@ int main(int argc, char** argv)
         const glm::mat4 view = glm::lookAt(position, position + forward, up);
         const glm::mat4 perspective = glm::perspective(glm::radians(FOV), width / height, 1.0f, 1000.0f);
         const glm::mat4 matrix_3d = perspective * view;
-        const glm::mat4 matrix_2d = glm::ortho(0.0f, width, height, 0.0f, -1.0f, 1.0f);
         SDL_FColor colors[] = {
             {1.0f, 0.0f, 0.0f, 1.0f},
             {0.0f, 1.0f, 0.0f, 1.0f},
@@ -163,11 +209,13 @@ int main(int argc, char** argv)
             {1.0f, 0.0f, 1.0f, 1.0f},
             {1.0f, 1.0f, 1.0f, 1.0f},
         };
+        SDL_SetGPUDViewport(width, height);
+        SDL_SetGPUDSlot(SDL_GPUD_SLOT_SCREEN);
         for (int i = 0; i < SDL_arraysize(colors); i++) {
             const float y = i * 2.0f + 2.0f;
             SDL_SetGPUDColor(&colors[i]);
-            SDL_DrawGPUDLine({0.0f, y}, {width, y});
-            SDL_DrawGPUDLine({0.0f, height - y}, {width, height - y});
+            SDL_DrawGPUDLine2D({0.0f, y}, {width, y});
+            SDL_DrawGPUDLine2D({0.0f, height - y}, {width, height - y});
         }
         SDL_SetGPUDColor({1.0f, 0.0f, 0.0f, 0.2f});
         SDL_DrawGPUDPoint({30.0f, height - 50.0f}, 20.0f);
@@ -181,19 +229,15 @@ int main(int argc, char** argv)
         SDL_DrawGPUDText("0123456789", 10.0f, 60.0f, 10);
         SDL_SetGPUDColor({1.0f, 1.0f, 1.0f, 1.0f});
         SDL_DrawGPUDText("!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~", 10.0f, 75.0f, 10);
-        SDL_SubmitGPUD(command_buffer, color_texture, NULL, &matrix_2d);
-        SDL_SetGPUDColor({1.0f, 1.0f, 1.0f, 1.0f});
-        const int grid = 10;
-        const float spacing = 10.0f;
-        for (int i = -grid; i <= grid; i++) {
-            const float x = i * spacing;
-            const float z = grid * spacing;
-            SDL_DrawGPUDLine({x, 0.0f, -z}, {x, 0.0f, z});
-        }
-        for (int i = -grid; i <= grid; i++) {
-            const float z = i * spacing;
-            const float x = grid * spacing;
-            SDL_DrawGPUDLine({-x, 0.0f, z}, {x, 0.0f, z});
+        const Uint64 frame_end = SDL_GetTicksNS();
+        if (frame_times) {
+            SDL_PushGPUDGraph(frame_times, (frame_end - frame_start) / 1000000.0f);
+            SDL_DrawGPUDGraph(frame_times, {10.0f, 90.0f, 240.0f, 40.0f}, 0.0f, 33.0f);
+        }
+        frame_start = frame_end;
+        SDL_SetGPUDSlot(SDL_GPUD_SLOT_WORLD);
+        if (grid) {
+            SDL_DrawGPUDGrid(grid, {position.x, 0.0f, position.z}, 1.0f);
         }
         SDL_SetGPUDColor({0.0f, 0.0f, 1.0f, 1.0f});
         SDL_DrawGPUDBox({10.0f, 10.0f, 10.0f}, {20.0f, 20.0f, 20.0f});
@@ -209,10 +253,36 @@ int main(int argc, char** argv)
         SDL_DrawGPUDLine({10.0f, 10.0f, -10.0f}, {10.0f, 10.0f, -20.0f});
         SDL_SetGPUDColor({1.0f, 0.0f, 1.0f, 1.0f});
         SDL_DrawGPUDSphere({-30.0f, 30.0f, 10.0f}, 10.0f);
-        SDL_SubmitGPUD(command_buffer, color_texture, depth_texture, &matrix_3d);
+        SDL_SetGPUDColor({1.0f, 1.0f, 1.0f, 1.0f});
+        SDL_DrawGPUDLabel("sphere", {-30.0f, 42.0f, 10.0f}, 10, true);
+        if (loopback) {
+            float matrix[16];
+            bool depth;
+            SDL_SeekIO(loopback, 0, SDL_IO_SEEK_SET);
+            SDL_StreamGPUD(&matrix_3d, true);
+            SDL_SeekIO(loopback, 0, SDL_IO_SEEK_SET);
+            if (SDL_ReceiveGPUDStream(loopback, matrix, &depth)) {
+                SDL_SubmitGPUD(command_buffer, color_texture, depth ? depth_texture : NULL, matrix);
+            }
+        } else if (sender) {
+            SDL_StreamGPUD(&matrix_3d, true);
+        } else {
+            SDL_SubmitGPUD(command_buffer, color_texture, depth_texture, &matrix_3d);
+        }
         SDL_SubmitGPUCommandBuffer(command_buffer);
     }
+    SDL_DestroyGPUDGraph(frame_times);
+    SDL_DestroyGPUDGrid(grid);
     SDL_QuitGPUD();
+    if (loopback) {
+        SDL_CloseIO(loopback);
+    }
+    if (sender) {
+        SDL_CloseIO(sender);
+    }
+    if (viewer) {
+        SDL_CloseIO(viewer);
+    }
     SDL_ReleaseGPUTexture(device, depth_texture);
     SDL_ReleaseWindowFromGPUDevice(device, window);
     SDL_DestroyGPUDevice(device);
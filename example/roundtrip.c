@@ -0,0 +1,471 @@
+#include <SDL3/SDL.h>
+#include <SDL_gpud.h>
+
+#include <stdlib.h>
+
+/* Headless checks that captures, replays, streams and rings reproduce the
+ * submits they were recorded from, that deduplication drops repeated lines,
+ * that sorted translucency orders points far to near, that a budget drops the
+ * newest lines, that text wraps, aligns and clips and that downsampled graphs
+ * keep the extremes of every run. Every check compares two capture files byte
+ * for byte, except graphs which are not captured and compare pixels */
+
+static SDL_GPUDevice* device;
+static SDL_GPUTexture* color_texture;
+static SDL_GPUTexture* depth_texture;
+
+static const Uint32 SIZE = 64;
+static const char* CAPTURE_PATH = "roundtrip_a.bin";
+static const char* REPLAY_PATH = "roundtrip_b.bin";
+
+static bool Init()
+{
+    if (!SDL_InitGPUD(device, SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM, SDL_GPU_TEXTUREFORMAT_D16_UNORM)) {
+        return false;
+    }
+    SDL_SetGPUDViewport(SIZE, SIZE);
+    return true;
+}
+
+static void GetMatrix(
+    float* matrix,
+    const int frame)
+{
+    SDL_memset(matrix, 0, 16 * sizeof(float));
+    matrix[0] = 0.1f;
+    matrix[5] = 0.1f;
+    matrix[10] = -0.01f;
+    matrix[12] = frame * 0.01f;
+    matrix[14] = 0.5f;
+    matrix[15] = 1.0f;
+}
+
+static bool Submit(
+    const float* matrix,
+    const bool depth)
+{
+    SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(device);
+    if (!command_buffer) {
+        return false;
+    }
+    SDL_SubmitGPUD(command_buffer, color_texture, depth ? depth_texture : NULL, matrix);
+    return SDL_SubmitGPUCommandBuffer(command_buffer);
+}
+
+/* Mostly the same from frame to frame, so streams are mostly deltas. Captures
+ * bake transforms and replays merge batches of the same type and slot, so the
+ * text keeps the transformed batch apart from the lines */
+static void Record(
+    const int frame)
+{
+    SDL_SetGPUDSlot(SDL_GPUD_SLOT_WORLD);
+    SDL_SetGPUDColor(&(SDL_FColor) {1.0f, 0.0f, 0.0f, 1.0f});
+    for (int i = 0; i < 16; i++) {
+        const SDL_GPUDVertex start = {(float) i, 0.0f, 0.0f, 0};
+        const SDL_GPUDVertex end = {(float) i, 1.0f + (i == frame), 0.0f, 0};
+        SDL_DrawGPUDLine(&start, &end);
+    }
+    SDL_SetGPUDSlot(SDL_GPUD_SLOT_SCREEN);
+    SDL_SetGPUDColor(&(SDL_FColor) {1.0f, 1.0f, 1.0f, 1.0f});
+    SDL_DrawGPUDText("roundtrip", 10.0f, 10.0f, 10);
+    SDL_SetGPUDSlot(SDL_GPUD_SLOT_WORLD);
+    const float transform[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        2.0f, 3.0f, (float) frame, 1.0f,
+    };
+    SDL_PushGPUDTransform(transform);
+    SDL_SetGPUDColor(&(SDL_FColor) {0.0f, 1.0f, 0.0f, 1.0f});
+    SDL_DrawGPUDBox(&(SDL_GPUDVertex) {0.0f, 0.0f, 0.0f, 0}, &(SDL_GPUDVertex) {1.0f, 1.0f, 1.0f, 0});
+    SDL_DrawGPUDCapsule(&(SDL_GPUDVertex) {0.0f, 0.0f, 0.0f, 0}, &(SDL_GPUDVertex) {0.0f, 2.0f, 0.0f, 0}, 0.5f);
+    SDL_PopGPUDTransform();
+}
+
+static void DrawLines(
+    const int count)
+{
+    SDL_SetGPUDColor(&(SDL_FColor) {1.0f, 0.0f, 1.0f, 1.0f});
+    for (int i = 0; i < count; i++) {
+        const SDL_GPUDVertex start = {(float) (i % 32), (float) (i / 32), 0.0f, 0};
+        const SDL_GPUDVertex end = {(float) (i % 32), (float) (i / 32) + 0.5f, 0.0f, 0};
+        SDL_DrawGPUDLine(&start, &end);
+    }
+}
+
+/* Replays and streams are already transformed, so they must ignore this */
+static const float OFFSET[16] = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    5.0f, 5.0f, 5.0f, 1.0f,
+};
+
+static bool CompareFiles()
+{
+    size_t size_a;
+    size_t size_b;
+    void* data_a = SDL_LoadFile(CAPTURE_PATH, &size_a);
+    void* data_b = SDL_LoadFile(REPLAY_PATH, &size_b);
+    const bool equal = data_a && data_b && size_a && size_a == size_b && !SDL_memcmp(data_a, data_b, size_a);
+    SDL_free(data_a);
+    SDL_free(data_b);
+    return equal;
+}
+
+static bool CheckReplay()
+{
+    float matrix[16];
+    if (!SDL_BeginGPUDCapture(CAPTURE_PATH)) {
+        return false;
+    }
+    for (int i = 0; i < 3; i++) {
+        Record(i);
+        GetMatrix(matrix, i);
+        Submit(matrix, i != 1);
+    }
+    SDL_EndGPUDCapture();
+    SDL_GPUDReplay* replay = SDL_OpenGPUDReplay(CAPTURE_PATH);
+    if (!replay) {
+        return false;
+    }
+    bool status = SDL_GetGPUDReplayFrames(replay) == 3 && SDL_BeginGPUDCapture(REPLAY_PATH);
+    SDL_PushGPUDTransform(OFFSET);
+    for (int i = 0; i < 3 && status; i++) {
+        SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(device);
+        status = command_buffer && SDL_ReplayGPUD(replay, i, command_buffer, color_texture, depth_texture);
+        status = command_buffer && SDL_SubmitGPUCommandBuffer(command_buffer) && status;
+    }
+    SDL_PopGPUDTransform();
+    SDL_EndGPUDCapture();
+    SDL_CloseGPUDReplay(replay);
+    return status && CompareFiles();
+}
+
+static bool CheckStream()
+{
+    float matrix[16];
+    SDL_IOStream* stream = SDL_IOFromDynamicMem();
+    if (!stream || !SDL_BeginGPUDStream(stream) || !SDL_BeginGPUDCapture(CAPTURE_PATH)) {
+        SDL_CloseIO(stream);
+        return false;
+    }
+    /* Every frame is recorded twice, streamed and then submitted */
+    for (int i = 0; i < 3; i++) {
+        GetMatrix(matrix, i);
+        Record(i);
+        SDL_StreamGPUD(matrix, i != 1);
+        Record(i);
+        Submit(matrix, i != 1);
+    }
+    SDL_EndGPUDStream();
+    SDL_EndGPUDCapture();
+    bool status = SDL_SeekIO(stream, 0, SDL_IO_SEEK_SET) == 0 && SDL_BeginGPUDCapture(REPLAY_PATH);
+    SDL_PushGPUDTransform(OFFSET);
+    for (int i = 0; i < 3 && status; i++) {
+        bool depth;
+        status = SDL_ReceiveGPUDStream(stream, matrix, &depth) && Submit(matrix, depth);
+    }
+    SDL_PopGPUDTransform();
+    SDL_EndGPUDCapture();
+    SDL_CloseIO(stream);
+    return status && CompareFiles();
+}
+
+/* Lines written to a ring must capture like the same lines drawn directly,
+ * after a rejected write of a partial triangle */
+static bool CheckRing()
+{
+    float matrix[16];
+    GetMatrix(matrix, 0);
+    SDL_GPUDVertex vertices[32];
+    for (int i = 0; i < 32; i++) {
+        vertices[i] = (SDL_GPUDVertex) {(float) (i / 2), (float) (i % 2), 0.0f, 0xFF0000FF};
+    }
+    SDL_SetGPUDColor(&(SDL_FColor) {1.0f, 0.0f, 0.0f, 1.0f});
+    if (!SDL_BeginGPUDCapture(CAPTURE_PATH)) {
+        return false;
+    }
+    for (int i = 0; i < 32; i += 2) {
+        SDL_DrawGPUDLine(&vertices[i], &vertices[i + 1]);
+    }
+    Submit(matrix, true);
+    SDL_EndGPUDCapture();
+    SDL_GPUDRing* ring = SDL_CreateGPUDRing("/sdl_gpud_roundtrip", 4096);
+    if (!ring) {
+        return false;
+    }
+    bool status = !SDL_WriteGPUDRing(ring, SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, vertices, 4);
+    status = status && SDL_WriteGPUDRing(ring, SDL_GPU_PRIMITIVETYPE_LINELIST, vertices, 32);
+    status = status && SDL_BeginGPUDCapture(REPLAY_PATH);
+    SDL_PushGPUDTransform(OFFSET);
+    SDL_DrawGPUDRing(ring);
+    SDL_PopGPUDTransform();
+    Submit(matrix, true);
+    SDL_EndGPUDCapture();
+    SDL_CloseGPUDRing(ring);
+    return status && CompareFiles();
+}
+
+/* Lines drawn twice with deduplication must capture like the same lines drawn
+ * once without it */
+static bool CheckDeduplicate()
+{
+    float matrix[16];
+    GetMatrix(matrix, 0);
+    SDL_SetGPUDDeduplicate(true);
+    if (!SDL_BeginGPUDCapture(CAPTURE_PATH)) {
+        SDL_SetGPUDDeduplicate(false);
+        return false;
+    }
+    DrawLines(64);
+    DrawLines(64);
+    Submit(matrix, true);
+    SDL_EndGPUDCapture();
+    SDL_SetGPUDDeduplicate(false);
+    int primitives;
+    int duplicates;
+    SDL_GetGPUDDuplicates(&primitives, &duplicates, NULL);
+    if (!SDL_BeginGPUDCapture(REPLAY_PATH)) {
+        return false;
+    }
+    DrawLines(64);
+    Submit(matrix, true);
+    SDL_EndGPUDCapture();
+    return primitives == 128 && duplicates == 64 && CompareFiles();
+}
+
+/* Shuffled sorted points must capture like the same points submitted far to
+ * near without sorting */
+static bool CheckSort()
+{
+    float matrix[16];
+    GetMatrix(matrix, 0);
+    SDL_SetGPUDColor(&(SDL_FColor) {0.0f, 0.0f, 1.0f, 0.5f});
+    SDL_SetGPUDTranslucency(SDL_GPUD_TRANSLUCENCY_SORTED);
+    if (!SDL_BeginGPUDCapture(CAPTURE_PATH)) {
+        return false;
+    }
+    for (int i = 0; i < 64; i++) {
+        const int j = i * 37 % 64;
+        SDL_DrawGPUDPoint(&(SDL_GPUDVertex) {(float) (j % 8), 0.0f, (float) j, 0}, 0.25f);
+    }
+    Submit(matrix, true);
+    SDL_EndGPUDCapture();
+    SDL_SetGPUDTranslucency(SDL_GPUD_TRANSLUCENCY_NONE);
+    if (!SDL_BeginGPUDCapture(REPLAY_PATH)) {
+        return false;
+    }
+    for (int i = 0; i < 64; i++) {
+        SDL_DrawGPUDPoint(&(SDL_GPUDVertex) {(float) (i % 8), 0.0f, (float) i, 0}, 0.25f);
+    }
+    Submit(matrix, true);
+    SDL_EndGPUDCapture();
+    return CompareFiles();
+}
+
+/* Lines past a budget that drops the newest must be left out of the capture,
+ * which then matches the lines that fit drawn without a budget. The budget is
+ * set before SDL_InitGPUD, so both halves initialize again */
+static bool CheckBudget()
+{
+    float matrix[16];
+    GetMatrix(matrix, 0);
+    SDL_QuitGPUD();
+    bool status = SDL_SetGPUDBudget(8192, SDL_GPUD_OVERFLOW_DROP_NEWEST) && Init() &&
+        SDL_BeginGPUDCapture(CAPTURE_PATH);
+    if (status) {
+        DrawLines(1024);
+        Submit(matrix, true);
+        SDL_EndGPUDCapture();
+    }
+    Uint64 dropped = 0;
+    SDL_GetGPUDOverflows(&dropped, NULL);
+    const int kept = 1024 - (int) (dropped / (2 * sizeof(SDL_GPUDVertex)));
+    SDL_QuitGPUD();
+    status = SDL_SetGPUDBudget(0, SDL_GPUD_OVERFLOW_GROW) && Init() && status && dropped && kept > 0;
+    if (!status || !SDL_BeginGPUDCapture(REPLAY_PATH)) {
+        return false;
+    }
+    DrawLines(kept);
+    Submit(matrix, true);
+    SDL_EndGPUDCapture();
+    return CompareFiles();
+}
+
+/* Wrapped, right aligned and clipped text must capture like its visible
+ * characters drawn line by line at the offsets SDL_MeasureGPUDText implies */
+static bool CheckText()
+{
+    float matrix[16];
+    GetMatrix(matrix, 0);
+    SDL_SetGPUDSlot(SDL_GPUD_SLOT_SCREEN);
+    SDL_SetGPUDColor(&(SDL_FColor) {1.0f, 1.0f, 1.0f, 1.0f});
+    /* Five characters of size 10 fit in 58 pixels, right aligned lines end at 60 */
+    SDL_SetGPUDTextWrap(58);
+    int width;
+    int height;
+    SDL_MeasureGPUDText("left right", 10, &width, &height);
+    SDL_SetGPUDTextAlign(SDL_GPUD_ALIGN_RIGHT);
+    SDL_SetGPUDTextClip(&(SDL_Rect) {0, 0, 30, SIZE});
+    bool status = SDL_BeginGPUDCapture(CAPTURE_PATH);
+    if (status) {
+        SDL_DrawGPUDText("left right", 2.0f, 10.0f, 10);
+        Submit(matrix, true);
+        SDL_EndGPUDCapture();
+    }
+    SDL_SetGPUDTextWrap(0);
+    SDL_SetGPUDTextAlign(SDL_GPUD_ALIGN_LEFT);
+    SDL_SetGPUDTextClip(NULL);
+    status = status && SDL_BeginGPUDCapture(REPLAY_PATH);
+    if (status) {
+        SDL_DrawGPUDText("le", 14.0f, 10.0f, 10);
+        SDL_DrawGPUDText("rig", 2.0f, 25.0f, 10);
+        Submit(matrix, true);
+        SDL_EndGPUDCapture();
+    }
+    SDL_SetGPUDSlot(SDL_GPUD_SLOT_WORLD);
+    return status && width == 58 && height == 25 && CompareFiles();
+}
+
+/* Clears the color texture, draws the graph over it and reads it back */
+static bool RenderGraph(
+    SDL_GPUDGraph* graph,
+    Uint8* pixels)
+{
+    float matrix[16];
+    GetMatrix(matrix, 0);
+    SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(device);
+    if (!command_buffer) {
+        return false;
+    }
+    SDL_GPUColorTargetInfo color_info = {0};
+    color_info.texture = color_texture;
+    color_info.load_op = SDL_GPU_LOADOP_CLEAR;
+    color_info.store_op = SDL_GPU_STOREOP_STORE;
+    SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(command_buffer, &color_info, 1, NULL);
+    if (render_pass) {
+        SDL_EndGPURenderPass(render_pass);
+    }
+    SDL_DrawGPUDGraph(graph, &(SDL_FRect) {0.0f, 0.0f, (float) SIZE, (float) SIZE}, 0.0f, 10.0f);
+    SDL_SubmitGPUD(command_buffer, color_texture, NULL, matrix);
+    SDL_GPUTransferBufferCreateInfo transfer_buffer_info = {0};
+    transfer_buffer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+    transfer_buffer_info.size = SIZE * SIZE * 4;
+    SDL_GPUTransferBuffer* transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_buffer_info);
+    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    if (transfer_buffer && copy_pass) {
+        SDL_GPUTextureRegion region = {0};
+        SDL_GPUTextureTransferInfo location = {0};
+        region.texture = color_texture;
+        region.w = SIZE;
+        region.h = SIZE;
+        region.d = 1;
+        location.transfer_buffer = transfer_buffer;
+        SDL_DownloadFromGPUTexture(copy_pass, &region, &location);
+    }
+    if (copy_pass) {
+        SDL_EndGPUCopyPass(copy_pass);
+    }
+    SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(command_buffer);
+    bool status = transfer_buffer && copy_pass && fence && SDL_WaitForGPUFences(device, true, &fence, 1);
+    void* data = status ? SDL_MapGPUTransferBuffer(device, transfer_buffer, false) : NULL;
+    if (data) {
+        SDL_memcpy(pixels, data, SIZE * SIZE * 4);
+        SDL_UnmapGPUTransferBuffer(device, transfer_buffer);
+    }
+    SDL_ReleaseGPUFence(device, fence);
+    SDL_ReleaseGPUTransferBuffer(device, transfer_buffer);
+    return data;
+}
+
+/* A graph downsampled by 4 must draw like the minimum and the maximum of every
+ * run of 4 samples pushed in their order without downsampling */
+static bool CheckGraph()
+{
+    static const float SAMPLES[16] = {5, 1, 9, 3, 2, 8, 0, 4, 7, 7, 7, 7, 3, 6, 2, 5};
+    static const float EXTREMES[8] = {1, 9, 8, 0, 7, 7, 6, 2};
+    SDL_SetGPUDSlot(SDL_GPUD_SLOT_SCREEN);
+    SDL_SetGPUDColor(&(SDL_FColor) {1.0f, 1.0f, 1.0f, 1.0f});
+    SDL_GPUDGraph* graph_a = SDL_CreateGPUDGraph(8, 4);
+    SDL_GPUDGraph* graph_b = SDL_CreateGPUDGraph(8, 1);
+    Uint8* pixels_a = SDL_malloc(SIZE * SIZE * 4);
+    Uint8* pixels_b = SDL_malloc(SIZE * SIZE * 4);
+    bool status = graph_a && graph_b && pixels_a && pixels_b;
+    for (int i = 0; i < 16 && status; i++) {
+        SDL_PushGPUDGraph(graph_a, SAMPLES[i]);
+    }
+    for (int i = 0; i < 8 && status; i++) {
+        SDL_PushGPUDGraph(graph_b, EXTREMES[i]);
+    }
+    status = status && RenderGraph(graph_a, pixels_a) && RenderGraph(graph_b, pixels_b);
+    status = status && !SDL_memcmp(pixels_a, pixels_b, SIZE * SIZE * 4);
+    SDL_free(pixels_a);
+    SDL_free(pixels_b);
+    SDL_DestroyGPUDGraph(graph_a);
+    SDL_DestroyGPUDGraph(graph_b);
+    SDL_SetGPUDSlot(SDL_GPUD_SLOT_WORLD);
+    return status;
+}
+
+int main()
+{
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_Log("Failed to initialize SDL: %s", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+    device = SDL_CreateGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL |
+        SDL_GPU_SHADERFORMAT_MSL, false, NULL);
+    if (!device) {
+        SDL_Log("Failed to create device: %s", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+    SDL_GPUTextureCreateInfo info = {0};
+    info.type = SDL_GPU_TEXTURETYPE_2D;
+    info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
+    info.width = SIZE;
+    info.height = SIZE;
+    info.layer_count_or_depth = 1;
+    info.num_levels = 1;
+    color_texture = SDL_CreateGPUTexture(device, &info);
+    info.format = SDL_GPU_TEXTUREFORMAT_D16_UNORM;
+    info.usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET;
+    depth_texture = SDL_CreateGPUTexture(device, &info);
+    if (!color_texture || !depth_texture) {
+        SDL_Log("Failed to create texture: %s", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+    if (!Init()) {
+        SDL_Log("Failed to initialize SDL GPUD: %s", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+    const struct
+    {
+        const char* name;
+        bool (*check)();
+    } checks[] = {
+        {"replay", CheckReplay},
+        {"stream", CheckStream},
+        {"ring", CheckRing},
+        {"deduplicate", CheckDeduplicate},
+        {"sort", CheckSort},
+        {"budget", CheckBudget},
+        {"text", CheckText},
+        {"graph", CheckGraph},
+    };
+    int failed = 0;
+    for (int i = 0; i < (int) SDL_arraysize(checks); i++) {
+        const bool passed = checks[i].check();
+        SDL_Log("%s: %s", checks[i].name, passed ? "passed" : "failed");
+        failed += !passed;
+    }
+    SDL_RemovePath(CAPTURE_PATH);
+    SDL_RemovePath(REPLAY_PATH);
+    SDL_QuitGPUD();
+    SDL_ReleaseGPUTexture(device, color_texture);
+    SDL_ReleaseGPUTexture(device, depth_texture);
+    SDL_DestroyGPUDevice(device);
+    SDL_Quit();
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
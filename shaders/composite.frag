@@ -0,0 +1,13 @@
+#version 450
+
+layout(location = 0) out vec4 o_color;
+layout(set = 2, binding = 0) uniform sampler2D s_overlay;
+layout(set = 3, binding = 0) uniform t_viewport
+{
+    vec2 u_viewport;
+};
+
+void main()
+{
+    o_color = texture(s_overlay, gl_FragCoord.xy / u_viewport);
+}
\ No newline at end of file
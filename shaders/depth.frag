@@ -0,0 +1,22 @@
+#version 450
+
+layout(set = 2, binding = 0) uniform sampler2D s_depth;
+layout(set = 3, binding = 0) uniform t_scale
+{
+    int u_scale;
+};
+
+void main()
+{
+    const ivec2 size = textureSize(s_depth, 0) - 1;
+    const ivec2 position = ivec2(gl_FragCoord.xy) * u_scale;
+    float depth = 0.0f;
+    for (int y = 0; y < u_scale; y++)
+    {
+        for (int x = 0; x < u_scale; x++)
+        {
+            depth = max(depth, texelFetch(s_depth, min(position + ivec2(x, y), size), 0).r);
+        }
+    }
+    gl_FragDepth = depth;
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#version 450
+
+void main()
+{
+    const vec2 position = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1) * 4.0f - 1.0f;
+    gl_Position = vec4(position, 0.0f, 1.0f);
+}
\ No newline at end of file
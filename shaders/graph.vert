@@ -0,0 +1,25 @@
+#version 450
+
+layout(location = 0) out flat uint o_color;
+layout(set = 0, binding = 0) readonly buffer t_values
+{
+    float u_values[];
+};
+layout(set = 1, binding = 0) uniform t_matrix
+{
+    mat4 u_matrix;
+};
+layout(set = 1, binding = 1) uniform t_graph
+{
+    uint u_capacity;
+    uint u_first;
+    uint u_color;
+};
+
+void main()
+{
+    /* x is the age of the sample in the history, oldest first */
+    const float value = u_values[(u_first + gl_VertexIndex) % u_capacity];
+    gl_Position = u_matrix * vec4(float(gl_VertexIndex), value, 0.0f, 1.0f);
+    o_color = u_color;
+}
\ No newline at end of file
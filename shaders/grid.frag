@@ -0,0 +1,44 @@
+#version 450
+
+layout(location = 0) in vec2 i_position;
+layout(location = 0) out vec4 o_color;
+layout(set = 3, binding = 0) uniform t_grid
+{
+    mat4 u_matrix;
+    mat4 u_inverse;
+    vec4 u_color;
+    vec2 u_center;
+    float u_spacing;
+    float u_radius;
+    int u_levels;
+};
+
+void main()
+{
+    const vec4 near = u_inverse * vec4(i_position, 0.0f, 1.0f);
+    const vec4 far = u_inverse * vec4(i_position, 1.0f, 1.0f);
+    const vec3 origin = near.xyz / near.w;
+    const vec3 direction = far.xyz * near.w - near.xyz * far.w;
+    const float t = -origin.y / direction.y;
+    const vec3 hit = origin + direction * t;
+    const vec4 position = u_matrix * vec4(hit, 1.0f);
+    const float depth = position.z / position.w;
+    float alpha = 0.0f;
+    float spacing = u_spacing;
+    for (int i = 0; i < u_levels; i++)
+    {
+        const vec2 coord = hit.xz / spacing;
+        const vec2 width = fwidth(coord);
+        const vec2 line = abs(fract(coord - 0.5f) - 0.5f) / width;
+        const float density = clamp(2.0f - 4.0f * max(width.x, width.y), 0.0f, 1.0f);
+        alpha = max(alpha, (1.0f - min(min(line.x, line.y), 1.0f)) * density * float(i + 1) / float(u_levels));
+        spacing *= 10.0f;
+    }
+    alpha *= u_color.a * max(0.0f, 1.0f - distance(hit.xz, u_center) / u_radius);
+    if (!(t > 0.0f) || depth < 0.0f || depth > 1.0f || alpha <= 0.0f)
+    {
+        discard;
+    }
+    o_color = vec4(u_color.rgb, alpha);
+    gl_FragDepth = depth;
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#version 450
+
+layout(location = 0) out vec2 o_position;
+
+void main()
+{
+    o_position = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1) * 4.0f - 1.0f;
+    gl_Position = vec4(o_position, 0.0f, 1.0f);
+}
\ No newline at end of file
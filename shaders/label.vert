@@ -0,0 +1,45 @@
+#version 450
+
+layout(location = 0) in vec3 i_anchor;
+layout(location = 1) in uint i_color;
+layout(location = 2) in vec2 i_pen;
+layout(location = 3) in uint i_glyph;
+layout(location = 0) out flat uint o_color;
+layout(set = 0, binding = 0) readonly buffer t_glyphs
+{
+    uint u_glyphs[];
+};
+layout(set = 1, binding = 0) uniform t_matrix
+{
+    mat4 u_matrix;
+};
+layout(set = 1, binding = 1) uniform t_label
+{
+    vec2 u_scale;
+};
+
+void main()
+{
+    const uint glyph = u_glyphs[i_glyph];
+    const uint stroke = uint(gl_VertexIndex) >> 1;
+    const vec4 anchor = u_matrix * vec4(i_anchor, 1.0f);
+    gl_Position = vec4(2.0f, 2.0f, 2.0f, 1.0f);
+    o_color = i_color;
+    if (stroke < (glyph >> 16) && anchor.w >= 1.192092896e-07f && anchor.z >= 0.0f && anchor.z <= anchor.w)
+    {
+        /* Every end of a stroke is one of five columns and five rows of the
+         * glyph, laid out as in DecodeText */
+        const uint code = u_glyphs[(glyph & 0xFFFFu) + stroke] >> ((gl_VertexIndex & 1) * 8);
+        const int size = int(i_pen.y);
+        const int middle = (size - 1) / 2;
+        const int quarter = size / 4;
+        const int even = ~size & 1;
+        const ivec4 x = int(i_pen.x) + ivec4(0, middle - quarter, middle, middle + quarter + even);
+        const ivec4 y = -size + ivec4(0, middle - quarter + even, middle, middle + quarter);
+        const uint column = code & 0xFu;
+        const uint row = (code >> 4) & 0xFu;
+        const vec2 offset = vec2(column == 4 ? int(i_pen.x) + size - 1 : x[column], row == 4 ? -1 : y[row]);
+        gl_Position = anchor;
+        gl_Position.xy += vec2(offset.x, -offset.y) * u_scale * anchor.w;
+    }
+}
\ No newline at end of file
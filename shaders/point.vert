@@ -0,0 +1,26 @@
+#version 450
+
+layout(location = 0) out flat uint o_color;
+layout(set = 0, binding = 0) readonly buffer t_points
+{
+    vec4 u_points[];
+};
+layout(set = 1, binding = 0) uniform t_matrix
+{
+    mat4 u_matrix;
+};
+layout(set = 1, binding = 1) uniform t_point
+{
+    vec2 u_size;
+    uint u_first;
+    uint u_stride;
+};
+
+void main()
+{
+    const vec4 point = u_points[u_first + gl_InstanceIndex * u_stride];
+    const vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1) * 2.0f - 1.0f;
+    gl_Position = u_matrix * vec4(point.xyz, 1.0f);
+    gl_Position.xy += corner * u_size * gl_Position.w;
+    o_color = floatBitsToUint(point.w);
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#version 450
+
+layout(location = 0) out vec4 o_color;
+layout(set = 2, binding = 0) uniform sampler2D s_accum;
+layout(set = 2, binding = 1) uniform sampler2D s_reveal;
+
+void main()
+{
+    const ivec2 position = ivec2(gl_FragCoord.xy);
+    const vec4 accum = texelFetch(s_accum, position, 0);
+    const float reveal = texelFetch(s_reveal, position, 0).r;
+    o_color = vec4(accum.rgb / max(accum.a, 1e-5f), 1.0f - reveal);
+}
\ No newline at end of file
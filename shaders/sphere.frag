@@ -0,0 +1,46 @@
+#version 450
+
+layout(location = 0) in vec2 i_position;
+layout(location = 1) in flat vec4 i_sphere;
+layout(location = 2) in flat uint i_color;
+layout(location = 0) out vec4 o_color;
+layout(set = 3, binding = 0) uniform t_matrix
+{
+    mat4 u_matrix;
+    mat4 u_inverse;
+};
+
+void main()
+{
+    const vec4 near = u_inverse * vec4(i_position, 0.0f, 1.0f);
+    const vec4 far = u_inverse * vec4(i_position, 1.0f, 1.0f);
+    const vec3 origin = near.xyz / near.w;
+    const vec3 direction = normalize(far.xyz * near.w - near.xyz * far.w);
+    const vec3 offset = origin - i_sphere.xyz;
+    const float b = dot(offset, direction);
+    const float h = b * b - dot(offset, offset) + i_sphere.w * i_sphere.w;
+    if (h < 0.0f)
+    {
+        discard;
+    }
+    float t = -b - sqrt(h);
+    if (t < 0.0f)
+    {
+        t = -b + sqrt(h);
+    }
+    const vec3 hit = origin + direction * t;
+    const vec4 position = u_matrix * vec4(hit, 1.0f);
+    const float depth = position.z / position.w;
+    if (t < 0.0f || depth > 1.0f)
+    {
+        discard;
+    }
+    const uint red = i_color >> 24 & 0xFF;
+    const uint green = i_color >> 16 & 0xFF;
+    const uint blue = i_color >> 8 & 0xFF;
+    const uint alpha = i_color >> 0 & 0xFF;
+    const vec4 color = vec4(red, green, blue, alpha) / 255.0f;
+    const float light = 0.5f + 0.5f * abs(dot(hit - i_sphere.xyz, direction)) / i_sphere.w;
+    o_color = vec4(color.rgb * light, color.a);
+    gl_FragDepth = depth;
+}
\ No newline at end of file
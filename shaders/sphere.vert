@@ -0,0 +1,37 @@
+#version 450
+
+layout(location = 0) in vec3 i_center;
+layout(location = 1) in uint i_color;
+layout(location = 2) in float i_radius;
+layout(location = 0) out vec2 o_position;
+layout(location = 1) out flat vec4 o_sphere;
+layout(location = 2) out flat uint o_color;
+layout(set = 1, binding = 0) uniform t_matrix
+{
+    mat4 u_matrix;
+};
+
+void main()
+{
+    vec2 lower = vec2(1.0f);
+    vec2 upper = vec2(-1.0f);
+    bool behind = false;
+    for (int i = 0; i < 8; i++)
+    {
+        const vec3 corner = vec3(i & 1, (i >> 1) & 1, i >> 2) * 2.0f - 1.0f;
+        const vec4 position = u_matrix * vec4(i_center + corner * i_radius, 1.0f);
+        behind = behind || position.w <= 0.0f;
+        lower = min(lower, position.xy / position.w);
+        upper = max(upper, position.xy / position.w);
+    }
+    if (behind)
+    {
+        lower = vec2(-1.0f);
+        upper = vec2(1.0f);
+    }
+    const vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    o_position = clamp(mix(lower, upper, corner), -1.0f, 1.0f);
+    o_sphere = vec4(i_center, i_radius);
+    o_color = i_color;
+    gl_Position = vec4(o_position, 0.0f, 1.0f);
+}
\ No newline at end of file
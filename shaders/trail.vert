@@ -0,0 +1,30 @@
+#version 450
+
+layout(location = 0) out flat uint o_color;
+layout(set = 0, binding = 0) readonly buffer t_positions
+{
+    vec4 u_positions[];
+};
+layout(set = 1, binding = 0) uniform t_matrix
+{
+    mat4 u_matrix;
+};
+layout(set = 1, binding = 1) uniform t_trail
+{
+    uint u_num_trails;
+    uint u_length;
+    uint u_first;
+    uint u_count;
+};
+
+void main()
+{
+    /* Segments are in age order, oldest first, and each joins a slot of the
+     * history to the next one */
+    const uint segment = uint(gl_VertexIndex) / 2;
+    const uint age = segment / u_num_trails;
+    const uint slot = (u_first + age + (gl_VertexIndex & 1)) % u_length;
+    const vec4 position = u_positions[slot * u_num_trails + segment % u_num_trails];
+    gl_Position = u_matrix * vec4(position.xyz, 1.0f);
+    o_color = (floatBitsToUint(position.w) & 0xFFFFFF00u) | ((age + 1) * 255 / u_count);
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#version 450
+
+layout(location = 0) in flat uint i_color;
+layout(location = 0) out vec4 o_accum;
+layout(location = 1) out float o_reveal;
+
+void main()
+{
+    const uint red = i_color >> 24 & 0xFF;
+    const uint green = i_color >> 16 & 0xFF;
+    const uint blue = i_color >> 8 & 0xFF;
+    const uint alpha = i_color >> 0 & 0xFF;
+    const vec4 color = vec4(red, green, blue, alpha) / 255.0f;
+    const float depth = 1.0f - gl_FragCoord.z;
+    const float weight = color.a * max(1e-2f, 3e3f * depth * depth * depth);
+    o_accum = vec4(color.rgb * color.a, color.a) * weight;
+    o_reveal = color.a;
+}
\ No newline at end of file